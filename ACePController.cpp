@@ -23,26 +23,30 @@
  */
 
 #include <SD.h>
+#include <avr/wdt.h>
+#include <util/crc16.h>
 #include "ACePController.h"
+#include "ACePMultiController.h"
+#include "QoiDecoder.h"
 #include "imagedata.h"
 
-#define DISPLAY_WIDTH   600
-#define DISPLAY_HEIGHT  448
-#define TARGET_FILESIZE ((uint32_t)DISPLAY_WIDTH * DISPLAY_HEIGHT / 2)
-
-#define ACEP_RESET_PIN  8
-#define ACEP_DC_PIN     9
-#define ACEP_CS_PIN     10
-#define ACEP_BUSY_PIN   7
-
 #define SD_CS_PIN       4
 #define SD_CD_PIN       5
 
+#define REFRESH_TIMEOUT 60000UL // msec
+
+#define COLLAGE_READ_AHEAD  64  // bytes / file
+
+#define BENCH_ROWS      32
+#define BENCH_BLOCKS    32
+
 #define waitShort()     delay(50)
 #define waitLong()      delay(200)
 
 
-PROGMEM static const uint8_t initialzeSequence1[] = {
+#define RESOLUTION(panel)   (panel::WIDTH >> 8), (panel::WIDTH & 0xFF), (panel::HEIGHT >> 8), (panel::HEIGHT & 0xFF)
+
+PROGMEM const uint8_t ACeP565Panel::initialzeSequence1[] = {
     // cmd,  data, ...
     3, 0x00, 0xEF, 0x08,
     5, 0x01, 0x37, 0x00, 0x23, 0x23,
@@ -52,20 +56,84 @@ PROGMEM static const uint8_t initialzeSequence1[] = {
     2, 0x40, 0x00,
     2, 0x50, 0x37,
     2, 0x60, 0x22,
-    5, 0x61, DISPLAY_WIDTH >> 8, DISPLAY_WIDTH & 0xFF, DISPLAY_HEIGHT >> 8, DISPLAY_HEIGHT & 0xFF,
+    5, 0x61, RESOLUTION(ACeP565Panel),
     2, 0xE3, 0xAA,
     0
 }; 
 
-PROGMEM static const uint8_t initialzeSequence2[] = {
+PROGMEM const uint8_t ACeP565Panel::initialzeSequence2[] = {
+    // cmd,  data, ...
+    2, 0x50, 0x37,
+    0
+};
+
+PROGMEM const uint8_t ACeP565Panel::displayStartSequence[] = {
+    // cmd,  data, ...
+    1, 0x92,
+    5, 0x61, RESOLUTION(ACeP565Panel),
+    1, 0x10,
+    0
+};
+
+PROGMEM const uint8_t ACeP401Panel::initialzeSequence1[] = {
     // cmd,  data, ...
+    3, 0x00, 0x2F, 0x00,
+    5, 0x01, 0x37, 0x00, 0x05, 0x05,
+    2, 0x03, 0x00,
+    4, 0x06, 0xC7, 0xC7, 0x1D,
+    2, 0x41, 0x00,
     2, 0x50, 0x37,
+    2, 0x60, 0x22,
+    5, 0x61, RESOLUTION(ACeP401Panel),
+    2, 0xE3, 0xAA,
     0
 };
 
-PROGMEM static const uint8_t displayStartSequence[] = {
+PROGMEM const uint8_t ACeP401Panel::initialzeSequence2[] = {
+    // cmd,  data, ...
+    2, 0x50, 0x37,
+    0
+};
+
+PROGMEM const uint8_t ACeP401Panel::displayStartSequence[] = {
+    // cmd,  data, ...
+    1, 0x92,
+    5, 0x61, RESOLUTION(ACeP401Panel),
+    1, 0x10,
+    0
+};
+
+PROGMEM const uint8_t ACeP730Panel::initialzeSequence1[] = {
+    // cmd,  data, ...
+    7, 0xAA, 0x49, 0x55, 0x20, 0x08, 0x09, 0x18,
+    7, 0x01, 0x3F, 0x00, 0x32, 0x2A, 0x0E, 0x2A,
+    3, 0x00, 0x5F, 0x69,
+    5, 0x03, 0x00, 0x54, 0x00, 0x44,
+    5, 0x05, 0x40, 0x1F, 0x1F, 0x2C,
+    5, 0x06, 0x6F, 0x1F, 0x1F, 0x22,
+    5, 0x08, 0x6F, 0x1F, 0x1F, 0x22,
+    3, 0x13, 0x00, 0x04,
+    2, 0x30, 0x3C,
+    2, 0x41, 0x00,
+    2, 0x50, 0x3F,
+    3, 0x60, 0x02, 0x00,
+    5, 0x61, RESOLUTION(ACeP730Panel),
+    2, 0x82, 0x1E,
+    2, 0x84, 0x00,
+    2, 0x86, 0x00,
+    2, 0xE3, 0x2F,
+    2, 0xE0, 0x00,
+    2, 0xE6, 0x00,
+    0
+};
+
+PROGMEM const uint8_t ACeP730Panel::initialzeSequence2[] = {
+    // cmd,  data, ...
+    0
+};
+
+PROGMEM const uint8_t ACeP730Panel::displayStartSequence[] = {
     // cmd,  data, ...
-    5, 0x61, DISPLAY_WIDTH >> 8, DISPLAY_WIDTH & 0xFF, DISPLAY_HEIGHT >> 8, DISPLAY_HEIGHT & 0xFF,
     1, 0x10,
     0
 };
@@ -89,40 +157,66 @@ PROGMEM static const uint8_t testDatePattern2[] = {
     IMG_ID_KANJI_THU, IMG_ID_KANJI_FRI, IMG_ID_KANJI_SAT, IMG_ID_KANJI_YEAR,
 };
 
+PROGMEM static const char headerMagic[] = ACEP_HEADER_MAGIC;
+PROGMEM static const char versionMagic[] = ACEP_VERSION_MAGIC;
+PROGMEM static const char tiledMagic[] = ACEP_TILED_MAGIC;
+PROGMEM static const char halfMagic[] = ACEP_HALF_MAGIC;
+PROGMEM static const char qoiMagic[] = QOI_HEADER_MAGIC;
+PROGMEM static const char packMagic[] = ACEP_PACK_MAGIC;
+PROGMEM static const char packPathFormat[] = "#%u %.8s";
+
+PROGMEM static const uint32_t crc32Table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+typedef struct {
+    File        file;
+    uint16_t    pos, len;
+    uint8_t     buffer[COLLAGE_READ_AHEAD];
+} CollageSource_T;
+
+static bool readCollageSource(CollageSource_T &source, uint8_t *pData, uint16_t len);
+static uint32_t updateCrc32(uint32_t crc, const uint8_t *pData, uint16_t len);
+static uint16_t updateCrc16(uint16_t crc, const uint8_t *pData, uint8_t len);
+
 /*---------------------------------------------------------------------------*/
 
-void ACePController::setup()
+template <class PANEL>
+void ACePController<PANEL>::setup()
 {
-    pinMode(ACEP_RESET_PIN, OUTPUT);
-    pinMode(ACEP_DC_PIN, OUTPUT);
-    pinMode(ACEP_CS_PIN, OUTPUT);
-    pinMode(ACEP_BUSY_PIN, INPUT); 
+    pinMode(resetPin, OUTPUT);
+    pinMode(dcPin, OUTPUT);
+    pinMode(csPin, OUTPUT);
+    pinMode(busyPin, INPUT); 
     pinMode(SD_CD_PIN, INPUT);
     pinMode(SD_CS_PIN, OUTPUT);
     isInitialized = false;
 }
 
-void ACePController::initialize()
+template <class PANEL>
+void ACePController<PANEL>::initialize()
 {
-    digitalWrite(ACEP_CS_PIN, HIGH);
+    waitRefresh();
+    digitalWrite(csPin, HIGH);
     digitalWrite(SD_CS_PIN, HIGH);
-    digitalWrite(ACEP_RESET_PIN, LOW);
+    digitalWrite(resetPin, LOW);
     waitShort();
-    digitalWrite(ACEP_RESET_PIN, HIGH);
+    digitalWrite(resetPin, HIGH);
     waitLong();
-    waitACePBusyHigh(100); // time limit = 5 secs
-    if (digitalRead(ACEP_BUSY_PIN) != HIGH) {
+    if (!waitACePBusyHigh(100)) { // time limit = 5 secs
         return;
     }
 
     SPI.begin();
-    applyACePSequence(initialzeSequence1);
+    applyACePSequence(PANEL::initialzeSequence1);
     waitShort();
-    applyACePSequence(initialzeSequence2);
+    applyACePSequence(PANEL::initialzeSequence2);
     isInitialized = true;
 }
 
-void ACePController::setDate(uint16_t year, uint8_t month, uint8_t day)
+template <class PANEL>
+void ACePController<PANEL>::setDate(uint16_t year, uint8_t month, uint8_t day)
 {
     placeDigits(&dateLetters[3], year, 4);
     dateLetters[4] = IMG_ID_KANJI_YEAR;
@@ -147,133 +241,272 @@ void ACePController::setDate(uint16_t year, uint8_t month, uint8_t day)
     }
 }
 
-bool ACePController::clearDisplay(ACEP_COLOR color)
+template <class PANEL>
+void ACePController<PANEL>::setTime(uint8_t hour, uint8_t minute)
+{
+    timeLetters[0] = IMG_ID_NUMBER_0 + hour / 10;
+    timeLetters[1] = IMG_ID_NUMBER_0 + hour % 10;
+    timeLetters[2] = IMG_ID_COLON;
+    timeLetters[3] = IMG_ID_NUMBER_0 + minute / 10;
+    timeLetters[4] = IMG_ID_NUMBER_0 + minute % 10;
+    isDisplayTime = true;
+}
+
+template <class PANEL>
+void ACePController<PANEL>::hideTime(void)
+{
+    isDisplayTime = false;
+}
+
+template <class PANEL>
+void ACePController<PANEL>::setViewport(uint16_t x, uint16_t y)
 {
+    viewportX = x;
+    viewportY = y;
+}
+
+template <class PANEL>
+void ACePController<PANEL>::setRotation(ACEP_ROTATION rotation)
+{
+    this->rotation = rotation;
+}
+
+template <class PANEL>
+void ACePController<PANEL>::setColorMap(const uint8_t *pMap)
+{
+    // Colors are replaced by nibbles, and the undefined ones are kept as they are
+    isColorMapped = false;
+    for (uint8_t i = 0; i < sizeof(colorMap); i++) {
+        colorMap[i] = (pMap && i < ACEP_COLORS && pMap[i] < ACEP_COLORS) ? pMap[i] : i;
+        isColorMapped = isColorMapped || colorMap[i] != i;
+    }
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::clearDisplay(ACEP_COLOR color)
+{
+    waitRefresh();
     if (!isInitialized || color < BLACK || color > ORANGE) {
         return false;
     }
-    applyACePSequence(displayStartSequence);
-    uint8_t buffer[DISPLAY_WIDTH / 2];
+    isBandValid = false;
+    applyACePSequence(PANEL::displayStartSequence);
+    uint8_t buffer[ROW_BYTES];
     memset(buffer, color | color << 4, sizeof(buffer));
     beginACePTransaction();
-    for (uint16_t y = 0; y < DISPLAY_HEIGHT; y++) {
+    for (uint16_t y = 0; y < HEIGHT; y++) {
         sendACePData(buffer, sizeof(buffer));
     }
     endACePTransaction();
-    refreshACePScreen();
-    return true;
+    return refreshACePScreen();
 }
 
-bool ACePController::displayACePDataFromPGM(
+template <class PANEL>
+bool ACePController<PANEL>::displayACePDataFromPGM(
         const uint8_t *pImage, uint16_t width, uint16_t height, bool isDisplayDate)
 {
+    waitRefresh();
     if (!isInitialized || !pImage || !width || !height) {
         return false;
     }
-    applyACePSequence(displayStartSequence);
-    uint8_t buffer[DISPLAY_WIDTH / 2];
+    isBandValid = false;
+    applyACePSequence(PANEL::displayStartSequence);
+    uint8_t buffer[ROW_BYTES];
     beginACePTransaction();
-    for (uint16_t y = 0; y < DISPLAY_HEIGHT; y++) {
+    for (uint16_t y = 0; y < HEIGHT; y++) {
         const uint8_t *pSrc = pImage + width / 2 * (y % height);
-        for (uint16_t x = 0, srcWidth = width / 2; x < DISPLAY_WIDTH / 2; x += srcWidth) {
-            if (srcWidth > DISPLAY_WIDTH / 2 - x) {
-                srcWidth = DISPLAY_WIDTH / 2 - x;
+        for (uint16_t x = 0, srcWidth = width / 2; x < ROW_BYTES; x += srcWidth) {
+            if (srcWidth > ROW_BYTES - x) {
+                srcWidth = ROW_BYTES - x;
             }
             memcpy_P(buffer + x, pSrc, srcWidth);
         }
+        remapColors(buffer);
         if (isDisplayDate) {
             overlapDateLetters(buffer, y);
         }
         sendACePData(buffer, sizeof(buffer));
     }
     endACePTransaction();
-    refreshACePScreen();
-    return true;
+    return refreshACePScreen();
 }
 
-bool ACePController::specifyImagePathOfSD(uint8_t index, char *path)
+template <class PANEL>
+bool ACePController<PANEL>::specifyImagePathOfSD(uint16_t index, char *path, ACEP_LAYOUT layout)
 {
+    // The first image is specified if the index is out of range
     path[0] = '\0';
     if (!isInitialized || digitalRead(SD_CD_PIN) == LOW) {
         return false;
     }
+    return scanImagesOfSD(index, path, layout) <= index;
+}
+
+template <class PANEL>
+uint16_t ACePController<PANEL>::countImagesOfSD(ACEP_LAYOUT layout)
+{
+    char path[PATH_LEN_MAX];
+    if (!isInitialized || digitalRead(SD_CD_PIN) == LOW) {
+        return 0;
+    }
+    return scanImagesOfSD(UINT16_MAX, path, layout);
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::canUpdateBands(const char *path)
+{
+    // The screen can be left as it is if both of it and the image have the signatures
+    waitRefresh();
+    if (!PANEL::HAS_PARTIAL_WINDOW || !isInitialized || !isBandValid || digitalRead(SD_CD_PIN) == LOW) {
+        return false;
+    }
 
-    bool ret = true;
     SD.begin(SD_CS_PIN);
     beginSDTransaction();
-    File root = SD.open(F("/")), entry;
-    bool isFirst = true;
-    while (entry = root.openNextFile()) {
-        if (!entry.isDirectory() && entry.size() == TARGET_FILESIZE && isTargetExtension(entry.name())) {
-            if (isFirst) {
-                strncpy(path, entry.name(), PATH_LEN_MAX);
-            }
-            if (index == 0) {
-                if (!isFirst) {
-                    strncpy(path, entry.name(), PATH_LEN_MAX);
-                }
-                ret = false;
-                break;
-            }
-            isFirst = false;
-            index--;
-        }
-        entry.close();
-    }
-    root.close();
+    uint32_t base, size;
+    uint16_t bands[BAND_COUNT];
+    bool hasBands = false;
+    File dataFile = openImage(path, base, size);
+    bool isReadOK = dataFile && readImageHeader(dataFile, base, size, bands, hasBands);
+    dataFile.close();
     endSDTransaction();
     SD.end();
-    return ret;
+    return isReadOK && hasBands;
 }
 
-bool ACePController::displayACePDataFromSD(const char *path, bool isDisplayDate)
+template <class PANEL>
+bool ACePController<PANEL>::displayACePDataFromSD(const char *path, bool isDisplayDate)
 {
+    waitRefresh();
     if (!isInitialized || digitalRead(SD_CD_PIN) == LOW) {
         return false;
     }
 
     SD.begin(SD_CS_PIN);
     beginSDTransaction();
-    File dataFile = SD.open(path);
+    uint32_t base, size;
+    uint16_t bands[BAND_COUNT];
+    bool hasBands = false;
+    File dataFile = openImage(path, base, size);
+    bool isReadOK = dataFile && readImageHeader(dataFile, base, size, bands, hasBands);
     endSDTransaction();
-    if (!dataFile) {
-        return false;
-    }
 
-    applyACePSequence(displayStartSequence);
-    uint8_t buffer[DISPLAY_WIDTH / 2];
-    for (uint16_t y = 0; y < DISPLAY_HEIGHT; y++) {
+    // Only the bands from the first to the last which differ from the screen are sent
+    // and refreshed in the partial window, and nothing is done if all of them are same
+    uint8_t first = 0, last = BAND_COUNT - 1;
+    if (isReadOK && hasBands) {
+        signBands(bands, isDisplayDate);
+        if (PANEL::HAS_PARTIAL_WINDOW && isBandValid) {
+            while (first < BAND_COUNT && bands[first] == bandSignatures[first]) {
+                first++;
+            }
+            while (last > first && bands[last] == bandSignatures[last]) {
+                last--;
+            }
+        }
+    }
+    if (!isReadOK || first == BAND_COUNT) {
         beginSDTransaction();
-        dataFile.read(buffer, sizeof(buffer));
+        dataFile.close();
         endSDTransaction();
-        if (isDisplayDate) {
-            overlapDateLetters(buffer, y);
-        }
-        beginACePTransaction();
-        sendACePData(buffer, sizeof(buffer));
-        endACePTransaction();
+        SD.end();
+        return isReadOK;
     }
+    uint16_t top = first * ACEP_BAND_H, bottom = (last + 1) * ACEP_BAND_H;
+    if (bottom > HEIGHT) {
+        bottom = HEIGHT;
+    }
+
+    // The signatures take effect only when the refresh has completed
+    isBandValid = false;
+    if (top == 0 && bottom == HEIGHT) {
+        applyACePSequence(PANEL::displayStartSequence);
+    } else {
+        applyPartialWindow(top, bottom);
+    }
+    isReadOK = sendImageRows(dataFile, top, bottom, isDisplayDate);
     beginSDTransaction();
     dataFile.close();
     endSDTransaction();
     SD.end();
-    refreshACePScreen();
-    return true;
+    isBandPending = isReadOK && hasBands;
+    if (isBandPending) {
+        memcpy(bandSignatures, bands, sizeof(bandSignatures));
+    }
+    return isReadOK && refreshACePScreen();
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::displayACePCollageFromSD(
+        const char paths[][PATH_LEN_MAX], ACEP_LAYOUT layout, bool isDisplayDate)
+{
+    waitRefresh();
+    if (!isInitialized || !paths || layout == LAYOUT_FULL || digitalRead(SD_CD_PIN) == LOW) {
+        return false;
+    }
+
+    // Two files are read at once for the left and right halves of each row, through
+    // small read-ahead buffers so that each half row reloads the SD block only once.
+    constexpr uint16_t halfRowBytes = ROW_BYTES / 2;
+    const uint16_t pieceHeight = (layout == LAYOUT_QUARTERS) ? HEIGHT / 2 : HEIGHT;
+    SD.begin(SD_CS_PIN);
+    isBandValid = false;
+    applyACePSequence(PANEL::displayStartSequence);
+    uint8_t buffer[ROW_BYTES];
+    CollageSource_T sources[2];
+    bool isReadOK = true;
+    for (uint8_t i = 0; i < layout && isReadOK; i += 2) {
+        beginSDTransaction();
+        for (uint8_t j = 0; j < 2; j++) {
+            uint32_t base, size;
+            sources[j].file = openImage(paths[i + j], base, size);
+            sources[j].pos = sources[j].len = 0;
+            isReadOK = isReadOK && sources[j].file;
+        }
+        endSDTransaction();
+        uint16_t top = i / 2 * pieceHeight;
+        for (uint16_t y = top; y < top + pieceHeight && isReadOK; y++) {
+            wdt_reset();
+            beginSDTransaction();
+            isReadOK = readCollageSource(sources[0], buffer, halfRowBytes) &&
+                    readCollageSource(sources[1], buffer + halfRowBytes, halfRowBytes);
+            endSDTransaction();
+            remapColors(buffer);
+            if (isDisplayDate) {
+                overlapDateLetters(buffer, y);
+                overlapTimeLetters(buffer, y);
+            }
+            beginACePTransaction();
+            sendACePData(buffer, sizeof(buffer));
+            endACePTransaction();
+        }
+        beginSDTransaction();
+        for (uint8_t j = 0; j < 2; j++) {
+            sources[j].file.close();
+        }
+        endSDTransaction();
+    }
+    SD.end();
+    return isReadOK && refreshACePScreen();
 }
 
-bool ACePController::displayACePTestPattern(bool isDisplayDate)
+template <class PANEL>
+bool ACePController<PANEL>::displayACePTestPattern(bool isDisplayDate)
 {
+    waitRefresh();
     if (!isInitialized) {
         return false;
     }
 
-    applyACePSequence(displayStartSequence);
-    uint8_t buffer[DISPLAY_WIDTH / 2];
+    isBandValid = false;
+    applyACePSequence(PANEL::displayStartSequence);
+    uint8_t buffer[ROW_BYTES];
     beginACePTransaction();
     for (uint8_t color = 0; color < 7; color++) {
         fgColor = (ACEP_COLOR)color;
         bgColor = (fgColor == WHITE || fgColor == YELLOW) ? BLACK : WHITE;
-        for (uint16_t y = 0; y < DISPLAY_HEIGHT / 7; y++) {
+        uint16_t bandHeight = (color < 6) ? HEIGHT / 7 : HEIGHT - HEIGHT / 7 * 6;
+        for (uint16_t y = 0; y < bandHeight; y++) {
             memset(buffer, color | color << 4, sizeof(buffer));
             if (isDisplayDate) {
                 memcpy_P(dateLetters, testDatePattern1, DATE_LETTERS_LEN);
@@ -285,23 +518,210 @@ bool ACePController::displayACePTestPattern(bool isDisplayDate)
         }
     }
     endACePTransaction();
-    refreshACePScreen();
+    return refreshACePScreen();
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::updateTimeBand(const char *path)
+{
+    waitRefresh();
+    if (!PANEL::HAS_PARTIAL_WINDOW || !isInitialized || !isDisplayTime || digitalRead(SD_CD_PIN) == LOW) {
+        return false;
+    }
+
+    // Only the rows of the time band are sent in the partial window and the rest is kept
+    constexpr uint16_t bandTop = HEIGHT - IMG_NUMBER_H;
+    SD.begin(SD_CS_PIN);
+    beginSDTransaction();
+    uint32_t base, size;
+    uint16_t bands[BAND_COUNT];
+    bool hasBands = false;
+    File dataFile = openImage(path, base, size);
+    bool isReadOK = dataFile && readImageHeader(dataFile, base, size, bands, hasBands);
+    endSDTransaction();
+    if (!isReadOK) {
+        beginSDTransaction();
+        dataFile.close();
+        endSDTransaction();
+        SD.end();
+        return false;
+    }
+
+    // The image has been checked when it was displayed, and the CRC isn't worth reading
+    // the whole payload again for the time band
+    imageCrcEnd = 0;
+    bool isBandKept = isBandValid && hasBands;
+    isBandValid = false;
+    applyPartialWindow(bandTop, HEIGHT);
+    isReadOK = sendImageRows(dataFile, bandTop, HEIGHT, true);
+    beginSDTransaction();
+    dataFile.close();
+    endSDTransaction();
+    SD.end();
+
+    // The signatures of the bands with the time are renewed for the next image
+    isBandPending = isReadOK && isBandKept;
+    if (isBandPending) {
+        signBands(bands, true);
+        for (uint8_t i = bandTop / ACEP_BAND_H; i < BAND_COUNT; i++) {
+            bandSignatures[i] = bands[i];
+        }
+    }
+    return isReadOK && refreshACePScreen();
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::benchmark(ACePBenchmark_T &result)
+{
+    waitRefresh();
+    isBandValid = false;
+    memset(&result, 0, sizeof(result));
+    if (!isInitialized) {
+        return false;
+    }
+
+    // Data are written to the frame memory without refresh
+    uint8_t buffer[ROW_BYTES];
+    memset(buffer, WHITE | WHITE << 4, sizeof(buffer));
+    applyACePSequence(PANEL::displayStartSequence);
+    uint32_t start = micros();
+    beginACePTransaction();
+    for (uint8_t i = 0; i < BENCH_ROWS; i++) {
+        sendACePData(buffer, sizeof(buffer));
+    }
+    endACePTransaction();
+    result.spiRow = (micros() - start) / BENCH_ROWS;
+
+    start = micros();
+    for (uint16_t y = 0; y < IMG_NUMBER_H; y++) {
+        overlapDateLetters(buffer, y);
+    }
+    result.overlapRow = (micros() - start) / IMG_NUMBER_H;
+
+    if (digitalRead(SD_CD_PIN) == LOW) {
+        return true;
+    }
+    char path[PATH_LEN_MAX];
+    start = micros();
+    specifyImagePathOfSD(UINT16_MAX, path);
+    result.dirScan = micros() - start;
+
+    SD.begin(SD_CS_PIN);
+    beginSDTransaction();
+    uint32_t base, size;
+    File dataFile = openImage(path, base, size);
+    if (dataFile) {
+        start = micros();
+        for (uint8_t i = 0; i < BENCH_ROWS; i++) {
+            dataFile.read(buffer, sizeof(buffer));
+        }
+        result.sdFileRow = (micros() - start) / BENCH_ROWS;
+        dataFile.close();
+    }
+    endSDTransaction();
+    SD.end();
+
+    Sd2Card card;
+    if (card.init(SPI_HALF_SPEED, SD_CS_PIN)) {
+        card.partialBlockRead(true);
+        start = micros();
+        for (uint8_t i = 0; i < BENCH_BLOCKS; i++) {
+            card.readData(i, 0, 256, buffer);
+            card.readData(i, 256, 256, buffer);
+        }
+        result.sdRawBlock = (micros() - start) / BENCH_BLOCKS;
+    }
     return true;
 }
 
-void ACePController::finish(void)
+template <class PANEL>
+void ACePController<PANEL>::setDeferredRefresh(bool isDeferred)
+{
+    isDeferredRefresh = isDeferred;
+}
+
+template <class PANEL>
+void ACePController<PANEL>::setRefreshCallback(void (*pFunc)(void))
+{
+    pRefreshCallback = pFunc;
+}
+
+template <class PANEL>
+ACEP_REFRESH_STATE ACePController<PANEL>::getRefreshState(void)
+{
+    return refreshState;
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::isBusy(void)
+{
+    return refreshState != REFRESH_IDLE;
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::pollRefresh(void)
 {
+    if ((refreshState == REFRESH_UPDATING || refreshState == REFRESH_POWER_OFF) &&
+            millis() - refreshTime >= REFRESH_TIMEOUT) {
+        isInitialized = false; // the panel must be initialized again
+        finishRefresh(false);
+    }
+    switch (refreshState) {
+        case REFRESH_UPDATING:
+            if (digitalRead(busyPin) == HIGH) {
+                beginACePTransaction();
+                sendACePCommand(0x02);
+                if (PANEL::HAS_REFRESH_PARAM) {
+                    sendACePData(0x00);
+                }
+                endACePTransaction();
+                refreshTime = millis();
+                refreshState = REFRESH_POWER_OFF;
+            }
+            break;
+        case REFRESH_POWER_OFF:
+            if (digitalRead(busyPin) == (PANEL::HAS_REFRESH_PARAM ? HIGH : LOW)) {
+                refreshTime = millis();
+                refreshState = REFRESH_SETTLING;
+            }
+            break;
+        case REFRESH_SETTLING:
+            if (millis() - refreshTime >= 200) {
+                finishRefresh(true);
+            }
+            break;
+        default:
+            break;
+    }
+    return refreshState == REFRESH_IDLE;
+}
+
+template <class PANEL>
+void ACePController<PANEL>::waitRefresh(void)
+{
+    while (!pollRefresh()) {
+        wdt_reset();
+        waitShort();
+    }
+}
+
+template <class PANEL>
+void ACePController<PANEL>::finish(void)
+{
+    waitRefresh();
     waitShort();
     applyACePSequence(sleepSequence);
     waitShort();
-    digitalWrite(ACEP_RESET_PIN, LOW);
+    digitalWrite(resetPin, LOW);
     SPI.end();
     isInitialized = false;
+    isBandValid = false; // the frame memory is lost in the deep sleep
 }
 
 /*---------------------------------------------------------------------------*/
 
-void ACePController::placeDigits(uint8_t *p, uint16_t number, uint8_t digits)
+template <class PANEL>
+void ACePController<PANEL>::placeDigits(uint8_t *p, uint16_t number, uint8_t digits)
 {
     bool isFirst = true;
     while (digits--) {
@@ -312,7 +732,8 @@ void ACePController::placeDigits(uint8_t *p, uint16_t number, uint8_t digits)
     }
 }
 
-uint8_t ACePController::calculateYoubi(uint16_t year, uint8_t month, uint8_t day)
+template <class PANEL>
+uint8_t ACePController<PANEL>::calculateYoubi(uint16_t year, uint8_t month, uint8_t day)
 {
     if (month < 3) {
         year--;
@@ -321,60 +742,517 @@ uint8_t ACePController::calculateYoubi(uint16_t year, uint8_t month, uint8_t day
     return (year + (year / 4) - (year / 100) + (year / 400) + (month * 13 + 8) / 5 + day) % 7;
 }
 
-bool ACePController::isTargetExtension(const char *path)
+template <class PANEL>
+bool ACePController<PANEL>::isTargetExtension(const char *path, const __FlashStringHelper *pExtension)
 {
     for (int i = 0; i < PATH_LEN_MAX - 4; i++, path++) {
-        if (memcmp_P(path, F(".ACP"), 4) == 0) {
+        if (memcmp_P(path, pExtension, 4) == 0) {
             return true;
         }
     }
     return false;
 }
 
-void ACePController::overlapDateLetters(uint8_t *pBuffer, uint16_t y)
+template <class PANEL>
+bool ACePController<PANEL>::isTargetSize(uint32_t size, ACEP_LAYOUT layout)
+{
+    // An image with a header is checked further when it is displayed
+    const uint32_t fileSize = TARGET_FILESIZE / layout;
+    return size == fileSize || (layout == LAYOUT_FULL && (size > fileSize ||
+            (size > HALF_DATASIZE && size <= HALF_DATASIZE + UINT8_MAX))); // up to the largest header
+}
+
+template <class PANEL>
+uint16_t ACePController<PANEL>::scanImagesOfSD(uint16_t index, char *path, ACEP_LAYOUT layout)
+{
+    // Returns the number of images gone through, which is the whole if the index is not reached
+    uint16_t count = 0;
+    SD.begin(SD_CS_PIN);
+    beginSDTransaction();
+    File pack = SD.open(F(ACEP_PACK_PATH));
+    if (pack) {
+        count = scanImagesOfPack(pack, index, path, layout);
+        pack.close();
+        endSDTransaction();
+        SD.end();
+        return count;
+    }
+    File root = SD.open(F("/")), entry;
+    while (count <= index && (entry = root.openNextFile())) {
+        wdt_reset();
+        if (!entry.isDirectory() && ((isTargetExtension(entry.name(), F(".ACP")) && isTargetSize(entry.size(), layout)) ||
+                (layout == LAYOUT_FULL && isTargetExtension(entry.name(), F(".QOI"))))) {
+            if (count == 0 || count == index) {
+                strncpy(path, entry.name(), PATH_LEN_MAX);
+            }
+            count++;
+        }
+        entry.close();
+    }
+    root.close();
+    endSDTransaction();
+    SD.end();
+    return count;
+}
+
+template <class PANEL>
+uint16_t ACePController<PANEL>::scanImagesOfPack(File &pack, uint16_t index, char *path, ACEP_LAYOUT layout)
+{
+    // The table is read through in one place instead of opening each file in the directory
+    ACePPackHeader_T header;
+    if (pack.read(&header, sizeof(header)) != sizeof(header) ||
+            memcmp_P(header.magic, packMagic, sizeof(header.magic)) != 0) {
+        return 0;
+    }
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < header.count && count <= index; i++) {
+        wdt_reset();
+        ACePPackEntry_T entry;
+        if (pack.read(&entry, sizeof(entry)) != sizeof(entry)) {
+            break;
+        }
+        if (entry.layout != layout) {
+            continue;
+        }
+        if (count == 0 || count == index) {
+            snprintf_P(path, PATH_LEN_MAX, packPathFormat, i, entry.name);
+        }
+        count++;
+    }
+    return count;
+}
+
+template <class PANEL>
+File ACePController<PANEL>::openImage(const char *path, uint32_t &base, uint32_t &size)
+{
+    if (path[0] != '#') {
+        File file = SD.open(path);
+        base = 0;
+        size = file ? file.size() : 0;
+        return file;
+    }
+
+    // The entry is looked up directly by its number
+    File file = SD.open(F(ACEP_PACK_PATH));
+    ACePPackHeader_T header;
+    ACePPackEntry_T entry;
+    uint16_t index = atoi(path + 1);
+    if (file && file.read(&header, sizeof(header)) == sizeof(header) &&
+            memcmp_P(header.magic, packMagic, sizeof(header.magic)) == 0 && index < header.count &&
+            file.seek(sizeof(header) + (uint32_t)index * sizeof(entry)) &&
+            file.read(&entry, sizeof(entry)) == sizeof(entry) && file.seek(entry.offset)) {
+        base = entry.offset;
+        size = entry.size;
+        return file;
+    }
+    file.close();
+    return File();
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::readImageHeader(File &file, uint32_t base, uint32_t size, uint16_t *pBands, bool &hasBands)
+{
+    // The image begins at the base, which is not 0 in the pack
+    imageOffset = base;
+    imageStride = ROW_BYTES;
+    imageEncoding = ENCODING_RAW;
+    imageCrcPos = imageCrcEnd = 0;
+    hasBands = false;
+    ACePVersionHeader_T header;
+    if (file.read(&header.common, sizeof(header.common)) != sizeof(header.common)) {
+        return false;
+    }
+
+    // A QOI image is decoded from the top with its own header, so it can't be cropped
+    // (the magic never appears at the top of raw data, whose nibbles are 0-6)
+    if (memcmp_P(header.common.magic, qoiMagic, sizeof(header.common.magic)) == 0) {
+        imageEncoding = ENCODING_QOI;
+        return file.seek(base);
+    }
+    if (size == TARGET_FILESIZE) {
+        return true;
+    }
+
+    // The legacy headers tell the format only by the magic
+    uint8_t format, flags = 0;
+    uint32_t dataOffset = sizeof(header.common);
+    if (memcmp_P(header.common.magic, versionMagic, sizeof(header.common.magic)) == 0) {
+        uint8_t *pRest = &header.version;
+        if (file.read(pRest, sizeof(header) - sizeof(header.common)) != sizeof(header) - sizeof(header.common) ||
+                header.version > ACEP_HEADER_VERSION || header.headerSize < sizeof(header)) {
+            return false;
+        }
+        format = header.format;
+        flags = header.flags;
+        dataOffset = header.headerSize;
+    } else if (memcmp_P(header.common.magic, tiledMagic, sizeof(header.common.magic)) == 0) {
+        format = ACEP_FORMAT_TILED;
+    } else if (memcmp_P(header.common.magic, halfMagic, sizeof(header.common.magic)) == 0) {
+        format = ACEP_FORMAT_HALF;
+    } else if (memcmp_P(header.common.magic, headerMagic, sizeof(header.common.magic)) == 0) {
+        format = ACEP_FORMAT_RAW;
+    } else {
+        return false;
+    }
+    imageOffset += dataOffset;
+
+    uint16_t width = header.common.width, height = header.common.height;
+    uint32_t dataSize;
+    bool isValid;
+    switch (format) {
+        case ACEP_FORMAT_RAW:
+            dataSize = (uint32_t)width / 2 * height;
+            isValid = width >= WIDTH && height >= HEIGHT && !(width & 1);
+            break;
+        case ACEP_FORMAT_TILED:
+            // A portrait image is stored as columns of tiles, 2 pixels wide each
+            imageEncoding = ENCODING_TILED;
+            dataSize = (uint32_t)HEIGHT / ACEP_TILE_W * TILES_PER_COLUMN * ACEP_TILE_BYTES;
+            isValid = width == HEIGHT && height == WIDTH;
+            break;
+        case ACEP_FORMAT_HALF:
+            // A half resolution image has each pixel doubled in both directions
+            imageEncoding = ENCODING_HALF;
+            imageStride = ROW_BYTES / 2;
+            dataSize = HALF_DATASIZE;
+            isValid = width == WIDTH / 2 && height == HEIGHT / 2;
+            break;
+        default:
+            return false;
+    }
+    if (!isValid || size < dataOffset + dataSize) {
+        return false;
+    }
+
+    // The band table is taken only if the rows of the payload are displayed as they are
+    if ((flags & ACEP_FLAG_BANDS) && dataOffset >= sizeof(header) + BAND_COUNT * sizeof(uint16_t) &&
+            (imageEncoding == ENCODING_HALF || (width == WIDTH && height == HEIGHT))) {
+        hasBands = file.read(pBands, BAND_COUNT * sizeof(uint16_t)) == BAND_COUNT * sizeof(uint16_t);
+        if (!hasBands) {
+            return false;
+        }
+    }
+
+    // The CRC is calculated over the payload while it is read in order for the display
+    if (flags & ACEP_FLAG_CRC) {
+        imageCrc = 0xFFFFFFFFUL;
+        imageCrcExpected = header.crc;
+        imageCrcPos = imageOffset;
+        imageCrcEnd = imageOffset + dataSize;
+    }
+
+    // A larger image is cropped at the viewport, which wraps around within the image
+    if (imageEncoding == ENCODING_RAW) {
+        uint16_t x = viewportX % (width - WIDTH + 1) & ~1;
+        uint16_t y = viewportY % (height - HEIGHT + 1);
+        imageStride = width / 2;
+        imageOffset += (uint32_t)y * imageStride + x / 2;
+    }
+    return true;
+}
+template <class PANEL>
+bool ACePController<PANEL>::readImageRow(File &file, uint8_t *pBuffer, uint16_t y)
+{
+    // Seek only when the row is not contiguous to the previous one
+    if (imageEncoding == ENCODING_HALF) {
+        y /= 2;
+    }
+    uint32_t pos = imageOffset + (uint32_t)y * imageStride;
+    if (file.position() != pos && !file.seek(pos)) {
+        return false;
+    }
+    return readImageData(file, pBuffer, (imageEncoding == ENCODING_HALF) ? ROW_BYTES / 2 : ROW_BYTES);
+}
+
+template <class PANEL>
+void ACePController<PANEL>::expandHalfRow(uint8_t *pBuffer, const uint8_t *pHalfRow)
+{
+    for (uint16_t i = 0; i < ROW_BYTES / 2; i++) {
+        uint8_t pair = *pHalfRow++;
+        *pBuffer++ = (pair & 0xF0) | pair >> 4;
+        *pBuffer++ = (pair & 0x0F) | pair << 4;
+    }
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::readImageData(File &file, uint8_t *pData, uint16_t len)
+{
+    // Only the data contiguous to the checked part are added, so reading a row again
+    // or seeking elsewhere just leaves the CRC unchecked
+    uint32_t pos = file.position();
+    if (file.read(pData, len) != len) {
+        return false;
+    }
+    if (pos == imageCrcPos && pos + len <= imageCrcEnd) {
+        imageCrc = updateCrc32(imageCrc, pData, len);
+        imageCrcPos += len;
+    }
+    return true;
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::readImageCrc(File &file, uint32_t end, uint8_t *pBuffer)
+{
+    // The payload which is not displayed is read only to carry the CRC on
+    if (imageCrcPos >= end) {
+        return true;
+    }
+    bool isReadOK = file.position() == imageCrcPos || file.seek(imageCrcPos);
+    while (imageCrcPos < end && isReadOK) {
+        wdt_reset();
+        uint16_t len = (end - imageCrcPos < ROW_BYTES) ? end - imageCrcPos : ROW_BYTES;
+        isReadOK = readImageData(file, pBuffer, len);
+    }
+    return isReadOK;
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::isImageCrcValid(void)
+{
+    // The CRC can't be told unless the whole payload has been read through
+    return imageCrcEnd == 0 || imageCrcPos < imageCrcEnd || ~imageCrc == imageCrcExpected;
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::sendImageRows(File &file, uint16_t top, uint16_t bottom, bool isDisplayDate)
+{
+    if (imageEncoding == ENCODING_TILED) {
+        return sendRotatedRows(file, top, isDisplayDate);
+    }
+    if (imageEncoding == ENCODING_QOI) {
+        return sendQoiRows(file, top, isDisplayDate);
+    }
+
+    // The source row of a half resolution image is kept to be expanded again for the odd row,
+    // so that each source row is read only once
+    const bool isHalf = (imageEncoding == ENCODING_HALF);
+    uint8_t buffer[ROW_BYTES], halfRow[ROW_BYTES / 2];
+    bool isReadOK = true;
+
+    // The CRC is only of the whole payload, so a partial update reads the rows out of the
+    // window too unless the rows aren't contiguous, i.e. a wider image is cropped
+    const bool isCrcFollowed = imageCrcEnd != 0 && imageStride == (isHalf ? ROW_BYTES / 2 : ROW_BYTES);
+    if (isCrcFollowed) {
+        beginSDTransaction();
+        isReadOK = readImageCrc(file, imageOffset + (uint32_t)(isHalf ? top / 2 : top) * imageStride, buffer);
+        endSDTransaction();
+    }
+    for (uint16_t y = top; y < bottom && isReadOK; y++) {
+        wdt_reset();
+        if (!isHalf || y == top || !(y & 1)) {
+            beginSDTransaction();
+            isReadOK = readImageRow(file, isHalf ? halfRow : buffer, y);
+            endSDTransaction();
+        }
+        if (isHalf) {
+            expandHalfRow(buffer, halfRow);
+        }
+        remapColors(buffer);
+        if (isDisplayDate) {
+            overlapDateLetters(buffer, y);
+            overlapTimeLetters(buffer, y);
+        }
+        beginACePTransaction();
+        sendACePData(buffer, sizeof(buffer));
+        endACePTransaction();
+    }
+    if (isCrcFollowed && isReadOK) {
+        beginSDTransaction();
+        isReadOK = readImageCrc(file, imageCrcEnd, buffer);
+        endSDTransaction();
+    }
+    return isReadOK && isImageCrcValid();
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::sendRotatedRows(File &file, uint16_t top, bool isDisplayDate)
+{
+    // A panel row is a column of the portrait image, i.e. one nibble of a tile column.
+    // Both nibbles are taken out of each tile at once, and the other one is kept in the
+    // second buffer for the next row which shares the tile column, so that each tile is
+    // read only once without caching the whole tile column.
+    uint8_t buffer[ROW_BYTES], nextBuffer[ROW_BYTES];
+    uint8_t tile[ACEP_TILE_BYTES];
+    uint16_t nextColumnIndex = 0xFFFF;
+    bool isReadOK = true;
+    for (uint16_t y = top; y < HEIGHT && isReadOK; y++) {
+        wdt_reset();
+        uint16_t imageX = (rotation == ROTATE_90) ? y : HEIGHT - 1 - y;
+        uint16_t columnIndex = imageX / ACEP_TILE_W * TILES_PER_COLUMN;
+        uint8_t *pBuffer = buffer;
+        if (columnIndex == nextColumnIndex) {
+            pBuffer = nextBuffer;
+            nextColumnIndex = 0xFFFF;
+        } else {
+            uint8_t shift = (imageX & 1) ? 0 : 4;
+            uint32_t pos = imageOffset + (uint32_t)columnIndex * ACEP_TILE_BYTES;
+            beginSDTransaction();
+            isReadOK = file.position() == pos || file.seek(pos);
+            for (uint8_t i = 0; i < TILES_PER_COLUMN && isReadOK; i++) {
+                isReadOK = readImageData(file, tile, ACEP_TILE_BYTES);
+                uint16_t imageY = i * ACEP_TILE_H;
+                uint8_t rows = (WIDTH - imageY < ACEP_TILE_H) ? WIDTH - imageY : ACEP_TILE_H;
+                for (uint8_t j = 0; j < rows; j++, imageY++) {
+                    uint8_t color = tile[j] >> shift & 0x0F;
+                    uint8_t nextColor = tile[j] >> (4 - shift) & 0x0F;
+                    uint16_t x = (rotation == ROTATE_90) ? WIDTH - 1 - imageY : imageY;
+                    uint8_t *p = &buffer[x / 2], *q = &nextBuffer[x / 2];
+                    if (x & 1) {
+                        *p = (*p & 0xF0) | color;
+                        *q = (*q & 0xF0) | nextColor;
+                    } else {
+                        *p = (*p & 0x0F) | color << 4;
+                        *q = (*q & 0x0F) | nextColor << 4;
+                    }
+                }
+            }
+            endSDTransaction();
+            nextColumnIndex = columnIndex;
+        }
+        remapColors(pBuffer);
+        if (isDisplayDate) {
+            overlapDateLetters(pBuffer, y);
+            overlapTimeLetters(pBuffer, y);
+        }
+        beginACePTransaction();
+        sendACePData(pBuffer, ROW_BYTES);
+        endACePTransaction();
+    }
+    return isReadOK && isImageCrcValid();
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::sendQoiRows(File &file, uint16_t top, bool isDisplayDate)
+{
+    // The rows above the top are decoded and discarded, as QOI has no random access.
+    // The decoder on the stack must not take more than the second row buffer and the tile
+    // of sendRotatedRows(), so that no format goes deeper than the others.
+    static_assert(sizeof(QoiDecoder) <= ROW_BYTES + ACEP_TILE_BYTES, "QoiDecoder is too large");
+    QoiDecoder decoder;
+    beginSDTransaction();
+    bool isReadOK = decoder.begin(file) && decoder.getWidth() == WIDTH && decoder.getHeight() == HEIGHT;
+    endSDTransaction();
+    uint8_t buffer[ROW_BYTES];
+    for (uint16_t y = 0; y < HEIGHT && isReadOK; y++) {
+        wdt_reset();
+        beginSDTransaction();
+        isReadOK = decoder.decodeRow(buffer, WIDTH, y);
+        endSDTransaction();
+        if (y < top) {
+            continue;
+        }
+        remapColors(buffer);
+        if (isDisplayDate) {
+            overlapDateLetters(buffer, y);
+            overlapTimeLetters(buffer, y);
+        }
+        beginACePTransaction();
+        sendACePData(buffer, sizeof(buffer));
+        endACePTransaction();
+    }
+    return isReadOK;
+}
+
+template <class PANEL>
+void ACePController<PANEL>::remapColors(uint8_t *pBuffer)
+{
+    if (!isColorMapped) {
+        return;
+    }
+    for (uint16_t i = 0; i < ROW_BYTES; i++, pBuffer++) {
+        *pBuffer = colorMap[*pBuffer >> 4] << 4 | colorMap[*pBuffer & 0x0F];
+    }
+}
+
+template <class PANEL>
+void ACePController<PANEL>::signBands(uint16_t *pBands, bool isDisplayDate)
+{
+    // The letters and the colors put over the image are folded into the CRC of each band
+    for (uint8_t i = 0; i < BAND_COUNT; i++, pBands++) {
+        uint16_t top = i * ACEP_BAND_H;
+        if (isDisplayDate && top < IMG_NUMBER_H) {
+            *pBands = updateCrc16(*pBands, dateLetters, DATE_LETTERS_LEN);
+        }
+        if (isDisplayDate && isDisplayTime && top + ACEP_BAND_H > HEIGHT - IMG_NUMBER_H) {
+            *pBands = updateCrc16(*pBands, timeLetters, TIME_LETTERS_LEN);
+        }
+        if (isColorMapped) {
+            *pBands = updateCrc16(*pBands, colorMap, ACEP_COLORS);
+        }
+    }
+}
+
+template <class PANEL>
+void ACePController<PANEL>::overlapDateLetters(uint8_t *pBuffer, uint16_t y)
+{
+    overlapLetters(pBuffer, y, dateLetters, DATE_LETTERS_LEN);
+}
+
+template <class PANEL>
+void ACePController<PANEL>::overlapTimeLetters(uint8_t *pBuffer, uint16_t y)
+{
+    if (isDisplayTime) {
+        overlapLetters(pBuffer, y - (HEIGHT - IMG_NUMBER_H), timeLetters, TIME_LETTERS_LEN);
+    }
+}
+
+template <class PANEL>
+void ACePController<PANEL>::overlapLetters(uint8_t *pBuffer, uint16_t y, const uint8_t *pLetters, uint8_t len)
 {
     if (y >= IMG_NUMBER_H) {
         return;
     }
-    pBuffer += (DISPLAY_WIDTH - IMG_LETTER_W * DATE_LETTERS_LEN) / 4;
-    for (uint8_t *pLetter = dateLetters; pLetter < dateLetters + DATE_LETTERS_LEN; pLetter++) {
-        const uint8_t *pImg;
+    pBuffer += (WIDTH - IMG_LETTER_W * len) / 4;
+    for (const uint8_t *pLetter = pLetters; pLetter < pLetters + len; pLetter++, pBuffer += IMG_LETTER_W / 2) {
+        uint8_t row;
         if (*pLetter < 10) {
-            pImg = &imgNumber[*pLetter][y * IMG_LETTER_W / 4];
-        } else if (*pLetter < 20 && y >= IMG_KANJI_OFFS) {
-            pImg = &imgKanji[*pLetter - 10][(y - IMG_KANJI_OFFS) * IMG_LETTER_W / 4];
+            row = y;
+        } else if (*pLetter < IMG_ID_COUNT && y >= IMG_KANJI_OFFS) {
+            row = y - IMG_KANJI_OFFS;
         } else {
-            pBuffer += IMG_LETTER_W / 2;
             continue;
         }
-        for (uint8_t i = 0; i < IMG_LETTER_W / 4; i++, pImg++) {
-            uint8_t b = pgm_read_byte(pImg);
-            for (uint8_t j = 0; j < 2; j++, pBuffer++) {
-                for (uint8_t k = 0; k < 2; k++) {
-                    if (b & 2) {
-                        *pBuffer &= 0xF << k * 4;
-                        *pBuffer |= ((b & 1) ? fgColor : bgColor) << (1 - k) * 4;
-                    }
-                    b >>= 2;
+        const uint8_t *pGlyph = imgGlyphData + pgm_read_word(&imgGlyphOffset[*pLetter]);
+        const uint8_t *pRun = pGlyph + ((*pLetter < 10) ? IMG_NUMBER_H : IMG_KANJI_H) + pgm_read_byte(pGlyph + row);
+        for (uint8_t x = 0; x < IMG_LETTER_W; ) {
+            uint8_t run = pgm_read_byte(pRun++);
+            uint8_t len = (run & IMG_RUN_LEN) + 1;
+            if (!(run & IMG_RUN_OPAQUE)) {
+                x += len;
+                continue;
+            }
+            uint8_t color = (run & IMG_RUN_FG) ? fgColor : bgColor;
+            for (; len > 0; len--, x++) {
+                uint8_t *p = pBuffer + x / 2;
+                if (x & 1) {
+                    *p = (*p & 0xF0) | color;
+                } else if (len >= 2) {
+                    *p = color << 4 | color;
+                    len--, x++;
+                } else {
+                    *p = (*p & 0x0F) | color << 4;
                 }
             }
         }
     }
 }
 
-void ACePController::beginACePTransaction(void)
+template <class PANEL>
+void ACePController<PANEL>::beginACePTransaction(void)
 {
-    digitalWrite(ACEP_CS_PIN, LOW);
+    digitalWrite(csPin, LOW);
     SPI.beginTransaction(spiSettings);
 }
 
-void ACePController::endACePTransaction(void)
+template <class PANEL>
+void ACePController<PANEL>::endACePTransaction(void)
 {
     SPI.endTransaction();
-    digitalWrite(ACEP_CS_PIN, HIGH);
+    digitalWrite(csPin, HIGH);
 }
 
-void ACePController::applyACePSequence(const uint8_t *pSequence)
+template <class PANEL>
+void ACePController<PANEL>::applyACePSequence(const uint8_t *pSequence)
 {
     beginACePTransaction();
     uint8_t len;
@@ -387,68 +1265,179 @@ void ACePController::applyACePSequence(const uint8_t *pSequence)
     endACePTransaction();
 }
 
-void ACePController::refreshACePScreen(void)
+template <class PANEL>
+void ACePController<PANEL>::applyPartialWindow(uint16_t top, uint16_t bottom)
+{
+    // The rows from the top to before the bottom are written and refreshed
+    beginACePTransaction();
+    sendACePCommand(0x91);
+    sendACePCommand(0x90);
+    sendACePData(0x00);
+    sendACePData(0x00);
+    sendACePData((WIDTH - 1) >> 8);
+    sendACePData((WIDTH - 1) & 0xFF);
+    sendACePData(top >> 8);
+    sendACePData(top & 0xFF);
+    sendACePData((bottom - 1) >> 8);
+    sendACePData((bottom - 1) & 0xFF);
+    sendACePData(0x01);
+    sendACePCommand(0x10);
+    endACePTransaction();
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::refreshACePScreen(void)
+{
+    if (!startRefresh()) {
+        return false;
+    }
+    if (!isDeferredRefresh) {
+        waitRefresh();
+    }
+    return isInitialized;
+}
+
+template <class PANEL>
+bool ACePController<PANEL>::startRefresh(void)
 {
     beginACePTransaction();
     sendACePCommand(0x04);
-    waitACePBusyHigh();
-    sendACePCommand(0x12);
-    waitACePBusyHigh();
-    sendACePCommand(0x02);
+    bool isPowerOn = waitACePBusyHigh();
+    if (isPowerOn) {
+        sendACePCommand(0x12);
+        if (PANEL::HAS_REFRESH_PARAM) {
+            sendACePData(0x00);
+        }
+    }
     endACePTransaction();
-    waitACePBusyLow();
-    waitLong();
+    if (!isPowerOn) {
+        isInitialized = false;
+        isBandPending = false;
+        return false;
+    }
+    refreshTime = millis();
+    refreshState = REFRESH_UPDATING;
+    return true;
 }
 
-void ACePController::sendACePCommand(const uint8_t command)
+template <class PANEL>
+void ACePController<PANEL>::finishRefresh(bool isCompleted)
 {
-    digitalWrite(ACEP_DC_PIN, LOW);
+    isBandValid = isCompleted && isBandPending;
+    isBandPending = false;
+    refreshState = REFRESH_IDLE;
+    if (pRefreshCallback) {
+        pRefreshCallback();
+    }
+}
+
+template <class PANEL>
+void ACePController<PANEL>::sendACePCommand(const uint8_t command)
+{
+    digitalWrite(dcPin, LOW);
     SPI.transfer(command);
 }
 
-void ACePController::sendACePPgmData(const uint8_t *pData, uint16_t len)
+template <class PANEL>
+void ACePController<PANEL>::sendACePPgmData(const uint8_t *pData, uint16_t len)
 {
-    digitalWrite(ACEP_DC_PIN, HIGH);
+    digitalWrite(dcPin, HIGH);
     while (len-- > 0) {
         SPI.transfer(pgm_read_byte(pData++));
     }
 }
 
-void ACePController::sendACePData(const uint8_t *pData, uint16_t len)
+template <class PANEL>
+void ACePController<PANEL>::sendACePData(const uint8_t *pData, uint16_t len)
 {
-    digitalWrite(ACEP_DC_PIN, HIGH);
+    digitalWrite(dcPin, HIGH);
     while (len-- > 0) {
         SPI.transfer(*pData++);
     }
 }
 
-void ACePController::sendACePData(const uint8_t data)
+template <class PANEL>
+void ACePController<PANEL>::sendACePData(const uint8_t data)
 {
-    digitalWrite(ACEP_DC_PIN, HIGH);
+    digitalWrite(dcPin, HIGH);
     SPI.transfer(data);
 }
 
-void ACePController::waitACePBusyLow(void)
+template <class PANEL>
+bool ACePController<PANEL>::waitACePBusyHigh(uint16_t limit)
 {
-    while (digitalRead(ACEP_BUSY_PIN) != LOW) {
+    uint16_t counter = 0;
+    while (digitalRead(busyPin) != HIGH) {
+        if (counter++ >= limit) {
+            return false;
+        }
+        wdt_reset();
         waitShort();
     }
+    return true;
 }
 
-void ACePController::waitACePBusyHigh(uint16_t limit)
+template <class PANEL>
+void ACePController<PANEL>::beginSDTransaction(void)
 {
-    uint16_t counter = 0;
-    while (digitalRead(ACEP_BUSY_PIN) != HIGH && (limit == 0 || counter++ < limit)) {
-        waitShort();
+    digitalWrite(SD_CS_PIN, LOW);
+}
+
+template <class PANEL>
+void ACePController<PANEL>::endSDTransaction(void)
+{
+    digitalWrite(SD_CS_PIN, HIGH);
+}
+
+/*---------------------------------------------------------------------------*/
+
+static bool readCollageSource(CollageSource_T &source, uint8_t *pData, uint16_t len)
+{
+    while (len > 0) {
+        if (source.pos >= source.len) {
+            int readLen = source.file.read(source.buffer, sizeof(source.buffer));
+            if (readLen <= 0) {
+                return false;
+            }
+            source.pos = 0;
+            source.len = readLen;
+        }
+        uint16_t copyLen = source.len - source.pos;
+        if (copyLen > len) {
+            copyLen = len;
+        }
+        memcpy(pData, source.buffer + source.pos, copyLen);
+        source.pos += copyLen;
+        pData += copyLen;
+        len -= copyLen;
     }
+    return true;
 }
 
-void ACePController::beginSDTransaction(void)
+static uint32_t updateCrc32(uint32_t crc, const uint8_t *pData, uint16_t len)
 {
-    digitalWrite(SD_CS_PIN, LOW);
+    // Reflected CRC-32 by nibbles, which needs only 64 bytes of table
+    while (len-- > 0) {
+        crc ^= *pData++;
+        crc = crc >> 4 ^ pgm_read_dword(&crc32Table[crc & 0x0F]);
+        crc = crc >> 4 ^ pgm_read_dword(&crc32Table[crc & 0x0F]);
+    }
+    return crc;
 }
 
-void ACePController::endSDTransaction(void)
+static uint16_t updateCrc16(uint16_t crc, const uint8_t *pData, uint8_t len)
 {
-    digitalWrite(SD_CS_PIN, HIGH);
+    while (len-- > 0) {
+        crc = _crc16_update(crc, *pData++);
+    }
+    return crc;
 }
+
+template class ACePController<ACeP565Panel>;
+template class ACePController<ACeP401Panel>;
+template class ACePController<ACeP730Panel>;
+
+// ACePMultiController is header only, and it is compiled here to be checked by every build
+template class ACePMultiController<ACeP565Panel, 2>;
+template class ACePMultiController<ACeP401Panel, 2>;
+template class ACePMultiController<ACeP730Panel, 2>;
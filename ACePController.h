@@ -26,6 +26,7 @@
 
 #include <arduino.h>
 #include <SPI.h>
+#include <SD.h>
 
 enum ACEP_COLOR : uint8_t
 {
@@ -38,14 +39,168 @@ enum ACEP_COLOR : uint8_t
     ORANGE,
 };
 
+#define ACEP_COLORS         7
+
+enum ACEP_LAYOUT : uint8_t
+{
+    LAYOUT_FULL = 1,        // one image of the panel size
+    LAYOUT_HALVES = 2,      // two images of (WIDTH / 2) x HEIGHT side by side
+    LAYOUT_QUARTERS = 4,    // four images of (WIDTH / 2) x (HEIGHT / 2)
+};
+
+enum ACEP_ROTATION : uint8_t
+{
+    ROTATE_90 = 0,  // clockwise
+    ROTATE_270,
+};
+
+enum ACEP_REFRESH_STATE : uint8_t
+{
+    REFRESH_IDLE = 0,
+    REFRESH_UPDATING,
+    REFRESH_POWER_OFF,
+    REFRESH_SETTLING,
+};
+
+#define ACEP_RESET_PIN      8
+#define ACEP_DC_PIN         9
+#define ACEP_CS_PIN         10
+#define ACEP_BUSY_PIN       7
+#define ACEP_BUSY_LIMIT     600 // x 50 msec
+
 #define PATH_LEN_MAX        16
 #define DATE_LETTERS_LEN    14
+#define TIME_LETTERS_LEN    5
+
+// Images other than the panel size begin with this header (little endian)
+#define ACEP_HEADER_MAGIC   "ACeP"
+#define ACEP_TILED_MAGIC    "ACeT"  // portrait image stored in tiles
+#define ACEP_HALF_MAGIC     "ACeH"  // half resolution image, scaled up 2x
+
+#define ACEP_TILE_W         2       // pixels
+#define ACEP_TILE_H         64
+#define ACEP_TILE_BYTES     (ACEP_TILE_W / 2 * ACEP_TILE_H)
+
+typedef struct {
+    char        magic[4];
+    uint16_t    width;      // must be even
+    uint16_t    height;
+} ACePHeader_T;
+
+// The versioned header tells the format of the payload and its CRC-32 (the same as zlib).
+// Images without this header are still recognized by the magics above or the size.
+#define ACEP_VERSION_MAGIC  "ACeV"
+#define ACEP_HEADER_VERSION 1
+
+#define ACEP_FLAG_CRC       0x01
+#define ACEP_FLAG_BANDS     0x02    // the band table follows the fields below
+
+// The band table has the CRC-16 (as _crc16_update from 0xFFFF) of the rows displayed
+// in each band, so that only the bands which differ from the screen are sent.
+// It is given only to raw images of the panel size and half resolution images.
+#define ACEP_BAND_H         16      // rows
+
+enum ACEP_FORMAT : uint8_t
+{
+    ACEP_FORMAT_RAW = 0,    // cropped at the viewport if larger than the panel
+    ACEP_FORMAT_TILED,
+    ACEP_FORMAT_HALF,
+};
+
+typedef struct {
+    ACePHeader_T common;
+    uint8_t     version;
+    uint8_t     headerSize; // the payload follows, for later versions to add fields
+    uint8_t     format;     // ACEP_FORMAT
+    uint8_t     flags;
+    uint32_t    crc;        // of the payload
+} ACePVersionHeader_T;
+
+// All images can be put in one pack file, which begins with the table of the entries.
+// An image in the pack is specified by the path "#<entry number> <name>".
+#define ACEP_PACK_PATH      "IMAGES.PAK"
+#define ACEP_PACK_MAGIC     "ACPK"
+#define ACEP_PACK_NAME_LEN  8
+
+typedef struct {
+    char        magic[4];
+    uint16_t    count;
+    uint16_t    reserved;
+} ACePPackHeader_T;
+
+typedef struct {
+    uint32_t    offset;     // from the top of the pack
+    uint32_t    size;
+    uint8_t     layout;     // ACEP_LAYOUT
+    uint8_t     reserved[3];
+    char        name[ACEP_PACK_NAME_LEN];   // not terminated if 8 letters
+} ACePPackEntry_T;
+
+typedef struct {
+    uint32_t    spiRow;     // usec / row to the panel
+    uint32_t    sdRawBlock; // usec / 512 bytes block by raw access
+    uint32_t    sdFileRow;  // usec / row by File
+    uint32_t    dirScan;    // usec / directory scan
+    uint32_t    overlapRow; // usec / row of date letters
+} ACePBenchmark_T;
+
+// Panel traits (the sequences are defined in ACePController.cpp)
+
+struct ACeP565Panel // 5.65 inch, 600x448
+{
+    static constexpr uint16_t WIDTH = 600;
+    static constexpr uint16_t HEIGHT = 448;
+    static constexpr bool HAS_PARTIAL_WINDOW = true;
+    static constexpr bool HAS_REFRESH_PARAM = false;
+    static const uint8_t initialzeSequence1[];
+    static const uint8_t initialzeSequence2[];
+    static const uint8_t displayStartSequence[];
+};
 
+struct ACeP401Panel // 4.01 inch, 640x400
+{
+    static constexpr uint16_t WIDTH = 640;
+    static constexpr uint16_t HEIGHT = 400;
+    static constexpr bool HAS_PARTIAL_WINDOW = true;
+    static constexpr bool HAS_REFRESH_PARAM = false;
+    static const uint8_t initialzeSequence1[];
+    static const uint8_t initialzeSequence2[];
+    static const uint8_t displayStartSequence[];
+};
+
+struct ACeP730Panel // 7.3 inch, 800x480
+{
+    static constexpr uint16_t WIDTH = 800;
+    static constexpr uint16_t HEIGHT = 480;
+    static constexpr bool HAS_PARTIAL_WINDOW = false;
+    static constexpr bool HAS_REFRESH_PARAM = true;
+    static const uint8_t initialzeSequence1[];
+    static const uint8_t initialzeSequence2[];
+    static const uint8_t displayStartSequence[];
+};
+
+#ifndef ACEP_PANEL
+#define ACEP_PANEL  ACeP565Panel
+#endif
+
+template <class PANEL>
 class ACePController
 {
 public:
-    ACePController()
-        : spiSettings(2000000, MSBFIRST, SPI_MODE0), fgColor(BLACK), bgColor(WHITE), isInitialized(false)
+    static constexpr uint16_t WIDTH = PANEL::WIDTH;
+    static constexpr uint16_t HEIGHT = PANEL::HEIGHT;
+    static constexpr uint16_t ROW_BYTES = PANEL::WIDTH / 2;
+    static constexpr uint32_t TARGET_FILESIZE = (uint32_t)ROW_BYTES * PANEL::HEIGHT;
+    static constexpr uint32_t HALF_DATASIZE = TARGET_FILESIZE / 4;
+    static constexpr uint8_t TILES_PER_COLUMN = (PANEL::WIDTH + ACEP_TILE_H - 1) / ACEP_TILE_H;
+    static constexpr uint8_t BAND_COUNT = (PANEL::HEIGHT + ACEP_BAND_H - 1) / ACEP_BAND_H;
+
+    ACePController(uint8_t csPin = ACEP_CS_PIN, uint8_t dcPin = ACEP_DC_PIN,
+            uint8_t busyPin = ACEP_BUSY_PIN, uint8_t resetPin = ACEP_RESET_PIN)
+        : spiSettings(2000000, MSBFIRST, SPI_MODE0), csPin(csPin), dcPin(dcPin), busyPin(busyPin),
+          resetPin(resetPin), viewportX(0), viewportY(0), rotation(ROTATE_90), fgColor(BLACK), bgColor(WHITE),
+          isInitialized(false), isColorMapped(false), isBandValid(false), isBandPending(false),
+          isDisplayTime(false), isDeferredRefresh(false), refreshState(REFRESH_IDLE), pRefreshCallback(NULL)
     {}
     ~ACePController()
     {}
@@ -53,34 +208,91 @@ public:
     void setup(void);
     void initialize(void);
     void setDate(uint16_t year, uint8_t month, uint8_t day);
+    void setTime(uint8_t hour, uint8_t minute);
+    void hideTime(void);
+    void setViewport(uint16_t x, uint16_t y);
+    void setRotation(ACEP_ROTATION rotation);
+    void setColorMap(const uint8_t *pMap);
     bool clearDisplay(ACEP_COLOR color = WHITE);
     bool displayACePDataFromPGM(
             const uint8_t *pImage, uint16_t width, uint16_t height, bool isDisplayDate = false);
-    bool specifyImagePathOfSD(uint8_t index, char *path);
+    bool specifyImagePathOfSD(uint16_t index, char *path, ACEP_LAYOUT layout = LAYOUT_FULL);
+    uint16_t countImagesOfSD(ACEP_LAYOUT layout = LAYOUT_FULL);
+    bool canUpdateBands(const char *path);
     bool displayACePDataFromSD(const char *path, bool isDisplayDate = false);
+    bool displayACePCollageFromSD(
+            const char paths[][PATH_LEN_MAX], ACEP_LAYOUT layout, bool isDisplayDate = false);
     bool displayACePTestPattern(bool isDisplayDate = false);
+    bool updateTimeBand(const char *path);
+    bool benchmark(ACePBenchmark_T &result);
+    void setDeferredRefresh(bool isDeferred);
+    void setRefreshCallback(void (*pFunc)(void));
+    ACEP_REFRESH_STATE getRefreshState(void);
+    bool isBusy(void);
+    bool pollRefresh(void);
+    void waitRefresh(void);
     void finish(void);
 
 private:
+    enum ACEP_ENCODING : uint8_t
+    {
+        ENCODING_RAW = 0,
+        ENCODING_TILED,
+        ENCODING_HALF,
+        ENCODING_QOI,
+    };
+
     void placeDigits(uint8_t *p, uint16_t number, uint8_t digits);
     uint8_t calculateYoubi(uint16_t year, uint8_t month, uint8_t day);
-    bool isTargetExtension(const char *path);
+    bool isTargetExtension(const char *path, const __FlashStringHelper *pExtension);
+    bool isTargetSize(uint32_t size, ACEP_LAYOUT layout);
+    uint16_t scanImagesOfSD(uint16_t index, char *path, ACEP_LAYOUT layout);
+    uint16_t scanImagesOfPack(File &pack, uint16_t index, char *path, ACEP_LAYOUT layout);
+    File openImage(const char *path, uint32_t &base, uint32_t &size);
+    bool readImageHeader(File &file, uint32_t base, uint32_t size, uint16_t *pBands, bool &hasBands);
+    bool readImageRow(File &file, uint8_t *pBuffer, uint16_t y);
+    void expandHalfRow(uint8_t *pBuffer, const uint8_t *pHalfRow);
+    bool readImageData(File &file, uint8_t *pData, uint16_t len);
+    bool readImageCrc(File &file, uint32_t end, uint8_t *pBuffer);
+    bool isImageCrcValid(void);
+    bool sendImageRows(File &file, uint16_t top, uint16_t bottom, bool isDisplayDate);
+    bool sendRotatedRows(File &file, uint16_t top, bool isDisplayDate);
+    bool sendQoiRows(File &file, uint16_t top, bool isDisplayDate);
+    void remapColors(uint8_t *pBuffer);
+    void signBands(uint16_t *pBands, bool isDisplayDate);
     void overlapDateLetters(uint8_t *pBuffer, uint16_t y);
+    void overlapTimeLetters(uint8_t *pBuffer, uint16_t y);
+    void overlapLetters(uint8_t *pBuffer, uint16_t y, const uint8_t *pLetters, uint8_t len);
     void beginACePTransaction(void);
     void endACePTransaction(void);
     void applyACePSequence(const uint8_t *pSequence);
-    void refreshACePScreen(void);
+    void applyPartialWindow(uint16_t top, uint16_t bottom);
+    bool refreshACePScreen(void);
+    bool startRefresh(void);
+    void finishRefresh(bool isCompleted);
     void sendACePCommand(const uint8_t command);
     void sendACePPgmData(const uint8_t *pData, uint16_t len);
     void sendACePData(const uint8_t *pData, uint16_t len);
     void sendACePData(const uint8_t data);
-    void waitACePBusyLow(void);
-    void waitACePBusyHigh(uint16_t limit = 0);
+    bool waitACePBusyHigh(uint16_t limit = ACEP_BUSY_LIMIT);
     void beginSDTransaction(void);
     void endSDTransaction(void);
 
     const SPISettings spiSettings;
+    const uint8_t csPin, dcPin, busyPin, resetPin;
     uint8_t dateLetters[DATE_LETTERS_LEN];
+    uint8_t timeLetters[TIME_LETTERS_LEN];
+    uint16_t viewportX, viewportY;
+    ACEP_ROTATION rotation;
+    uint32_t imageOffset;
+    uint16_t imageStride;
+    ACEP_ENCODING imageEncoding;
+    uint32_t imageCrc, imageCrcExpected, imageCrcPos, imageCrcEnd;
     ACEP_COLOR fgColor, bgColor;
-    bool isInitialized;
+    uint8_t colorMap[16];
+    uint16_t bandSignatures[BAND_COUNT];
+    bool isInitialized, isColorMapped, isBandValid, isBandPending, isDisplayTime, isDeferredRefresh;
+    ACEP_REFRESH_STATE refreshState;
+    uint32_t refreshTime;
+    void (*pRefreshCallback)(void);
 };
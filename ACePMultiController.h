@@ -0,0 +1,113 @@
+/**
+ * ArduinoACePCalendar : "ACePMultiController.h"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "ACePController.h"
+
+// Drives several panels sharing SPI and SD. The frame of each panel is streamed
+// while the previous panels are refreshing, so the total time is about one refresh.
+
+template <class PANEL, uint8_t N>
+class ACePMultiController
+{
+public:
+    ACePMultiController(ACePController<PANEL> *pPanels) : pPanels(pPanels)
+    {}
+    ~ACePMultiController()
+    {}
+
+    void setup(void)
+    {
+        for (uint8_t i = 0; i < N; i++) {
+            pPanels[i].setup();
+            pPanels[i].setDeferredRefresh(true);
+        }
+    }
+
+    void initialize(void)
+    {
+        for (uint8_t i = 0; i < N; i++) {
+            pPanels[i].initialize();
+        }
+    }
+
+    void setDate(uint16_t year, uint8_t month, uint8_t day)
+    {
+        for (uint8_t i = 0; i < N; i++) {
+            pPanels[i].setDate(year, month, day);
+        }
+    }
+
+    bool clearDisplay(ACEP_COLOR color = WHITE)
+    {
+        bool ret = true;
+        for (uint8_t i = 0; i < N; i++) {
+            ret = pPanels[i].clearDisplay(color) && ret;
+        }
+        waitRefresh();
+        return ret;
+    }
+
+    bool displayACePDataFromSD(const char * const paths[], bool isDisplayDate = false)
+    {
+        bool ret = true;
+        for (uint8_t i = 0; i < N; i++) {
+            ret = pPanels[i].displayACePDataFromSD(paths[i], isDisplayDate) && ret;
+        }
+        waitRefresh();
+        return ret;
+    }
+
+    bool pollRefresh(void)
+    {
+        bool ret = true;
+        for (uint8_t i = 0; i < N; i++) {
+            ret = pPanels[i].pollRefresh() && ret;
+        }
+        return ret;
+    }
+
+    void waitRefresh(void)
+    {
+        for (uint8_t i = 0; i < N; i++) {
+            pPanels[i].waitRefresh();
+        }
+    }
+
+    void finish(void)
+    {
+        for (uint8_t i = 0; i < N; i++) {
+            pPanels[i].finish();
+        }
+    }
+
+    ACePController<PANEL> &operator[](uint8_t index)
+    {
+        return pPanels[index];
+    }
+
+private:
+    ACePController<PANEL> *pPanels;
+};
@@ -24,21 +24,61 @@
 
 #include <arduino.h>
 #include <avr/sleep.h>
+#include <avr/wdt.h>
 #include "RX8900Controller.h"
 #include "ACePController.h"
+#include "TaskController.h"
+#include "StateController.h"
+#include "ScheduleController.h"
+#include "Logger.h"
 
 #define ALARM_WAKE_PIN      2
 #define SHELL_ENABLE_PIN    3
 
 #define SERIAL_BAUD_RATE    9600
 
+#define REFRESH_POLL_INTERVAL   100
+#define SHELL_CHECK_INTERVAL    1000
+#define SHELL_IDLE_TIMEOUT      (10UL * 60UL * 1000UL) // msec (0 = never)
+
+#define FAULT_MAGIC         0xFA17
+
+#define VIEWPORT_STEP_X     120 // pixels / day for larger images
+#define VIEWPORT_STEP_Y     64
+#define PORTRAIT_ROTATION   ROTATE_90 // or ROTATE_270 for tiled portrait images
+#define SHUFFLE_ROUNDS      4
+
 void printShellMessage(void);
 void printShellPrompt(void);
 void handleSerialInput(char data);
+void handleShellTimeout(void);
+
+RX8900Controller            rtc;
+ACePController<ACEP_PANEL>  acep;
+TaskController              tasks;
+StateController             state;
+ScheduleController          schedule;
+bool                        isShellEnabled;
 
-RX8900Controller    rtc;
-ACePController      acep;
-bool                isShellEnabled;
+static uint32_t             lastInputTime;
+static char                 currentPath[PATH_LEN_MAX];
+static bool                 isDisplayFailed;
+
+// Kept over the watchdog reset to know which phase has hung
+static uint16_t faultMagic __attribute__ ((section (".noinit")));
+static uint8_t  faultPhase __attribute__ ((section (".noinit")));
+static uint8_t  resetFlags __attribute__ ((section (".noinit")));
+
+/*---------------------------------------------------------------------------*/
+
+// Runs before the C runtime: the watchdog stays armed over its own reset
+void saveResetFlags(void) __attribute__ ((naked, used, section (".init3")));
+void saveResetFlags(void)
+{
+    resetFlags = MCUSR;
+    MCUSR = 0;
+    wdt_disable();
+}
 
 /*---------------------------------------------------------------------------*/
 
@@ -50,53 +90,365 @@ void setup(void)
     bool isAlarmWake = digitalRead(ALARM_WAKE_PIN) == LOW;
     if (isShellEnabled) {
         Serial.begin(SERIAL_BAUD_RATE);
+        logger.begin();
         printShellMessage();
     }
+    bool isWatchdogReset = (resetFlags & _BV(WDRF)) && faultMagic == FAULT_MAGIC;
+    FAULT_PHASE lastPhase = isWatchdogReset ? (FAULT_PHASE)faultPhase : FAULT_NONE;
+    state.setup();
+    wdt_enable(WDTO_8S);
+    // The RTC is set up even after it has hung, or its alarm flag would keep /INT low
+    // and the MCU could never be woken up again
+    enterPhase(FAULT_RTC);
     rtc.setup();
+    restoreState();
+    loadSchedule();
+    if (lastPhase != FAULT_NONE) {
+        // Degraded mode: skip the display for today instead of hanging again
+        LOG_WARN("Hung in phase %d", lastPhase);
+        state.recordFault(lastPhase);
+        state.save();
+        rtc.suspendAlarm();
+        isAlarmWake = false;
+        isDisplayFailed = lastPhase >= FAULT_PANEL; // retried by the evening entry
+    }
+    scheduleNextAlarm();
+    scheduleClock();
+    enterPhase(FAULT_PANEL);
     acep.setup();
+    acep.setRotation(PORTRAIT_ROTATION);
+    uint8_t colorMap[ACEP_COLORS];
+    if (state.getColorMap(colorMap)) {
+        acep.setColorMap(colorMap);
+    }
+    acep.setDeferredRefresh(isShellEnabled);
     acep.initialize();
+    enterPhase(FAULT_NONE);
+    wdt_disable();
     if (isShellEnabled) {
         printShellPrompt();
     }
+    tasks.addPinTask(doSchedule, ALARM_WAKE_PIN);
+    tasks.addEventTask(serviceSerial, isSerialAvailable);
+    tasks.addTimerTask(serviceRefresh, REFRESH_POLL_INTERVAL);
+    tasks.addEventTask(serviceLog, isLogPending);
+    tasks.addTimerTask(checkShellTimeout, SHELL_CHECK_INTERVAL);
     if (isAlarmWake) {
-        doToday();
+        doSchedule();
     }
 }
 
 void loop(void)
 {
-    if (digitalRead(ALARM_WAKE_PIN) == LOW) {
-        doToday();
-    }
     if (isShellEnabled) {
-        int serialData;
-        while ((serialData = Serial.read()) != -1) {
-            handleSerialInput(serialData);
-        }
-        delay(100);
+        tasks.run();
     } else {
-        acep.finish();
-        sleep();
-        acep.initialize();
+        if (digitalRead(ALARM_WAKE_PIN) == LOW) {
+            doSchedule();
+        }
+        if (state.getClockInterval() > 0) {
+            // Keep the frame memory of the panel for the time band
+            acep.waitRefresh();
+            sleep();
+        } else {
+            acep.finish();
+            sleep();
+            acep.initialize();
+        }
     }
 }
 
-static void doToday(void)
+static void doSchedule(void)
 {
+    wdt_enable(WDTO_8S);
+    enterPhase(FAULT_RTC);
+    bool isAlarm = true, isTimer = false;
+    rtc.getInterrupts(isAlarm, isTimer);
     rtc.suspendAlarm();
+    SCHEDULE_ACTION action = SCHEDULE_NONE;
+    uint8_t weekDay, hour, minute, second;
+    if (isAlarm && rtc.getWeekDay(weekDay) && rtc.getTime(hour, minute, second)) {
+        action = schedule.getDueAction(weekDay, hour, minute);
+    }
+    scheduleClock();
+    bool isOK = true;
+    switch (action) {
+        case SCHEDULE_RETRY:
+            // The screen may be left cleared or half drawn by the failure
+            if (isDisplayFailed) {
+                isOK = displayImage(false);
+            }
+            break;
+        case SCHEDULE_PHOTO:
+            isOK = displayImage(true);
+            break;
+        case SCHEDULE_REDRAW:
+            isOK = displayImage(false);
+            break;
+        case SCHEDULE_CLEAN:
+            isOK = cleanDisplay() &&
+                    displayImage(schedule.isActionDue(SCHEDULE_PHOTO, weekDay, hour, minute));
+            break;
+        default:
+            if (isTimer) {
+                isOK = updateClock();
+            }
+            break;
+    }
+    if (action != SCHEDULE_NONE) {
+        isDisplayFailed = !isOK;
+    }
+    if (!isOK) {
+        LOG_ERROR("Failed in phase %d", faultPhase);
+        state.recordFault((FAULT_PHASE)faultPhase);
+        state.save();
+    }
+    enterPhase(FAULT_RTC);
+    scheduleNextAlarm();
+    enterPhase(FAULT_NONE);
+    wdt_disable();
+}
+
+static bool displayImage(bool isNext)
+{
+    enterPhase(FAULT_RTC);
     uint16_t year;
     uint8_t month, day;
     if (rtc.getDate(year, month, day)) {
         acep.setDate(year, month, day);
     }
-    acep.clearDisplay();
-    uint8_t index = rtc.getImageIndex();
-    char path[PATH_LEN_MAX];
-    if (acep.specifyImagePathOfSD(index, path)) {
+    enterPhase(FAULT_SCAN);
+    ACEP_LAYOUT layout = getLayout();
+    uint16_t index = state.getImageIndex();
+    if (!isNext) {
+        index = (index >= layout) ? index - layout : 0;
+    }
+    uint16_t seed = 0, count = 0;
+    if (state.getShuffle(seed)) {
+        count = acep.countImagesOfSD(layout);
+        if (index >= count) {
+            index = 0;
+            if (isNext) {
+                state.renewShuffleSeed(); // another order for the next round
+                state.getShuffle(seed);
+            }
+        }
+    }
+    char paths[LAYOUT_QUARTERS][PATH_LEN_MAX];
+    if (specifyImagePath(index, paths[0], layout, seed, count)) {
         index = 0;
     }
-    rtc.setImageIndex(index + 1);
-    acep.displayACePDataFromSD(path, true);
+    for (uint8_t i = 1; i < layout; i++) {
+        specifyImagePath(index + i, paths[i], layout, seed, count); // the first one if wrapped around
+    }
+
+    // The screen is not cleared if only the bands which differ are to be updated
+    enterPhase(FAULT_PANEL);
+    if ((layout != LAYOUT_FULL || !acep.canUpdateBands(paths[0])) && !acep.clearDisplay()) {
+        return false;
+    }
+    if (isNext) {
+        rtc.setImageIndex(index + layout); // before EEPROM, which takes longer to be written
+        state.setImageIndex(index + layout);
+        state.countDisplay();
+        state.save();
+    }
+    setDailyViewport();
+    enterPhase(FAULT_DISPLAY);
+    LOG_INFO("Display [%u] %s", index, paths[0]);
+    if (layout != LAYOUT_FULL) {
+        return acep.displayACePCollageFromSD(paths, layout, true);
+    }
+    strcpy(currentPath, paths[0]);
+    return acep.displayACePDataFromSD(paths[0], true);
+}
+
+static bool updateClock(void)
+{
+    // Only the time band is sent, over the image displayed last
+    if (!currentPath[0]) {
+        enterPhase(FAULT_SCAN);
+        uint16_t index = state.getImageIndex();
+        uint16_t seed = 0, count = 0;
+        if (state.getShuffle(seed)) {
+            count = acep.countImagesOfSD();
+        }
+        if (specifyImagePath((index > 0) ? index - 1 : 0, currentPath, LAYOUT_FULL, seed, count)) {
+            specifyImagePath(0, currentPath, LAYOUT_FULL, seed, count);
+        }
+    }
+    setDailyViewport();
+    enterPhase(FAULT_DISPLAY);
+    return acep.updateTimeBand(currentPath);
+}
+
+static bool specifyImagePath(uint16_t index, char *path, ACEP_LAYOUT layout, uint16_t seed, uint16_t count)
+{
+    // The index is taken as the position in the shuffled order if the count is given
+    if (count > 0) {
+        index = permuteIndex(index % count, count, seed);
+    }
+    return acep.specifyImagePathOfSD(index, path, layout);
+}
+
+static uint16_t permuteIndex(uint16_t position, uint16_t count, uint16_t seed)
+{
+    // A keyed Feistel network is a bijection over 4^n positions,
+    // so it is walked over again until the result falls in the range
+    uint8_t bits = 1;
+    while ((1UL << (bits * 2)) < count) {
+        bits++;
+    }
+    const uint16_t mask = (1U << bits) - 1;
+    do {
+        uint16_t left = position >> bits, right = position & mask, key = seed;
+        for (uint8_t round = 0; round < SHUFFLE_ROUNDS; round++) {
+            key = key * 25173U + 13849U;
+            uint16_t hash = (right ^ key) * 0x9E3BU;
+            uint16_t next = left ^ ((hash ^ hash >> 8) & mask);
+            left = right;
+            right = next;
+        }
+        position = left << bits | right;
+    } while (position >= count);
+    return position;
+}
+
+static void setDailyViewport(void)
+{
+    // A larger image shows a different crop every day
+    uint16_t count = state.getDisplayCount();
+    acep.setViewport(count * VIEWPORT_STEP_X, count * VIEWPORT_STEP_Y);
+}
+
+static bool cleanDisplay(void)
+{
+    // Drive all the particles back and forth to reduce the ghost
+    enterPhase(FAULT_PANEL);
+    bool isOK = true;
+    for (uint8_t color = BLACK; isOK && color <= ORANGE; color++) {
+        isOK = acep.clearDisplay((ACEP_COLOR)color);
+    }
+    return isOK;
+}
+
+bool scheduleNextAlarm(void)
+{
+    uint8_t weekDay, hour, minute, second;
+    if (!rtc.getWeekDay(weekDay) || !rtc.getTime(hour, minute, second)) {
+        return false;
+    }
+    uint8_t nextWeekDay, nextHour, nextMinute;
+    schedule.getNextEntry(weekDay, hour, minute, nextWeekDay, nextHour, nextMinute);
+    return rtc.setAlarm(nextHour, nextMinute, 1 << nextWeekDay);
+}
+
+bool scheduleClock(void)
+{
+    // The timer is aligned to the interval on every wake, e.g. o'clock for 60 minutes
+    uint8_t interval = state.getClockInterval();
+    uint8_t hour, minute, second;
+    if (interval == 0 || getLayout() != LAYOUT_FULL || !rtc.getTime(hour, minute, second)) {
+        acep.hideTime();
+        return rtc.setTimer(0);
+    }
+    acep.setTime(hour, minute);
+    return rtc.setTimer(interval - (hour * 60 + minute) % interval);
+}
+
+ACEP_LAYOUT getLayout(void)
+{
+    uint8_t layout = state.getLayout();
+    return (layout == LAYOUT_HALVES || layout == LAYOUT_QUARTERS) ? (ACEP_LAYOUT)layout : LAYOUT_FULL;
+}
+
+uint16_t mapImageIndex(uint16_t index)
+{
+    // The position in the shuffled order is turned into the index of the file
+    uint16_t seed;
+    if (!state.getShuffle(seed)) {
+        return index;
+    }
+    uint16_t count = acep.countImagesOfSD();
+    return (count > 0) ? permuteIndex(index % count, count, seed) : index;
+}
+
+static void enterPhase(FAULT_PHASE phase)
+{
+    faultMagic = FAULT_MAGIC;
+    faultPhase = phase;
+}
+
+static void restoreState(void)
+{
+    // The RTC RAM caches the low byte of the image index, which is ahead of EEPROM
+    // only if the record was lost while being written, and it is the whole index
+    // kept by older versions before any record is written
+    uint16_t index = state.getImageIndex();
+    if (!rtc.wasReset()) {
+        uint8_t cache = rtc.getImageIndex();
+        uint8_t delta = cache - (uint8_t)index;
+        if (!state.hasRecord()) {
+            index = cache;
+        } else if (delta < 0x80) {
+            index += delta;
+        }
+        state.setImageIndex(index);
+        state.save();
+    }
+    rtc.setImageIndex(index);
+}
+
+static void loadSchedule(void)
+{
+    uint8_t hour, minute;
+    if (!state.getAlarm(hour, minute)) {
+        // Take over the alarm time which was kept only in the RTC by older versions
+        if (!rtc.getAlarm(hour, minute)) {
+            return;
+        }
+        state.setAlarm(hour, minute);
+        state.save();
+    }
+    schedule.setAlarmTime(hour, minute);
+}
+
+static bool isSerialAvailable(void)
+{
+    return Serial.available() > 0;
+}
+
+static void serviceSerial(void)
+{
+    int serialData;
+    while ((serialData = Serial.read()) != -1) {
+        handleSerialInput(serialData);
+    }
+    lastInputTime = millis();
+}
+
+static void checkShellTimeout(void)
+{
+    // Fall back to the power-down mode if nobody has typed for a long time
+    if (SHELL_IDLE_TIMEOUT > 0 && isShellEnabled && !acep.isBusy() &&
+            millis() - lastInputTime >= SHELL_IDLE_TIMEOUT) {
+        handleShellTimeout();
+    }
+}
+
+static bool isLogPending(void)
+{
+    return logger.isPending();
+}
+
+static void serviceLog(void)
+{
+    logger.flush();
+}
+
+static void serviceRefresh(void)
+{
+    acep.pollRefresh();
 }
 
 static void wakeUp(void)
@@ -106,6 +458,11 @@ static void wakeUp(void)
 
 static void sleep(void)
 {
+    // No falling edge comes while the interrupt of the RTC is left pending
+    if (digitalRead(ALARM_WAKE_PIN) == LOW) {
+        rtc.suspendAlarm();
+        scheduleNextAlarm();
+    }
     uint8_t adcsraBak = ADCSRA;
     ADCSRA = 0;
     set_sleep_mode(SLEEP_MODE_PWR_DOWN);
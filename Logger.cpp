@@ -0,0 +1,84 @@
+/**
+ * ArduinoACePCalendar : "Logger.cpp"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdarg.h>
+#include "Logger.h"
+
+// Messages are queued to the ring buffer and moved to the transmit buffer of Serial
+// only as far as it has room, so logging never waits for the serial line.
+
+Logger logger;
+
+/*---------------------------------------------------------------------------*/
+
+void Logger::begin(void)
+{
+    head = tail = 0;
+    isActive = true;
+}
+
+void Logger::end(void)
+{
+    isActive = false;
+}
+
+void Logger::printf_P(const char *pFormat, ...)
+{
+    if (!isActive) {
+        return;
+    }
+    char line[LOG_LINE_MAX];
+    va_list args;
+    va_start(args, pFormat);
+    vsnprintf_P(line, sizeof(line), pFormat, args);
+    va_end(args);
+    for (char *p = line; *p; p++) {
+        uint8_t next = (head + 1) & (LOG_BUF_SIZE - 1);
+        if (next == tail) {
+            droppedCount++;
+            continue;
+        }
+        buffer[head] = *p;
+        head = next;
+    }
+    flush();
+}
+
+bool Logger::isPending(void)
+{
+    return isActive && head != tail && Serial.availableForWrite() > 0;
+}
+
+void Logger::flush(void)
+{
+    while (isActive && head != tail && Serial.availableForWrite() > 0) {
+        Serial.write(buffer[tail]);
+        tail = (tail + 1) & (LOG_BUF_SIZE - 1);
+    }
+}
+
+uint16_t Logger::getDroppedCount(void)
+{
+    return droppedCount;
+}
@@ -0,0 +1,90 @@
+/**
+ * ArduinoACePCalendar : "Logger.h"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <arduino.h>
+
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL       LOG_LEVEL_INFO
+#endif
+
+#define LOG_BUF_SIZE    128 // must be power of 2
+#define LOG_LINE_MAX    48
+
+// Messages below LOG_LEVEL are removed at compile time, and the format strings are kept in PROGMEM.
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(format, ...)  logger.printf_P(PSTR("E: " format "\r\n"), ##__VA_ARGS__)
+#else
+#define LOG_ERROR(format, ...)  do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(format, ...)   logger.printf_P(PSTR("W: " format "\r\n"), ##__VA_ARGS__)
+#else
+#define LOG_WARN(format, ...)   do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(format, ...)   logger.printf_P(PSTR("I: " format "\r\n"), ##__VA_ARGS__)
+#else
+#define LOG_INFO(format, ...)   do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(format, ...)  logger.printf_P(PSTR("D: " format "\r\n"), ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(format, ...)  do {} while (0)
+#endif
+
+class Logger
+{
+public:
+    Logger() : head(0), tail(0), droppedCount(0), isActive(false)
+    {}
+    ~Logger()
+    {}
+
+    void begin(void);
+    void end(void);
+    void printf_P(const char *pFormat, ...);
+    bool isPending(void);
+    void flush(void);
+    uint16_t getDroppedCount(void);
+
+private:
+    char buffer[LOG_BUF_SIZE];
+    uint8_t head, tail;
+    uint16_t droppedCount;
+    bool isActive;
+};
+
+extern Logger logger;
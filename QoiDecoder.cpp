@@ -0,0 +1,188 @@
+/**
+ * ArduinoACePCalendar : "QoiDecoder.cpp"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "QoiDecoder.h"
+#include "ACePController.h"
+
+// The pixels are decoded one by one with the 64-entry color index of QOI format,
+// so the state is only 256 bytes regardless of the image size. Each pixel is
+// quantized to the panel colors by ordered dithering, which needs no row buffer.
+
+#define QOI_OP_INDEX    0x00
+#define QOI_OP_DIFF     0x40
+#define QOI_OP_LUMA     0x80
+#define QOI_OP_RUN      0xC0
+#define QOI_OP_RGB      0xFE
+#define QOI_OP_RGBA     0xFF
+#define QOI_MASK        0xC0
+
+#define DITHER_SPREAD   16  // per step of the Bayer matrix (-120 to +120)
+
+PROGMEM static const char qoiMagic[] = QOI_HEADER_MAGIC;
+
+PROGMEM static const uint8_t paletteColors[ACEP_COLORS][3] = {
+    { 0, 0, 0 }, { 255, 255, 255 }, { 0, 128, 0 }, { 0, 0, 255 },
+    { 255, 0, 0 }, { 255, 255, 0 }, { 255, 170, 0 },
+};
+
+PROGMEM static const uint8_t bayerMatrix[4][4] = {
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 },
+};
+
+static uint8_t quantizeColor(const uint8_t *pPixel, uint16_t x, uint16_t y);
+
+/*---------------------------------------------------------------------------*/
+
+bool QoiDecoder::begin(File &file)
+{
+    uint8_t header[14]; // magic, width, height (big endian), channels, colorspace
+    pFile = &file;
+    if (file.read(header, sizeof(header)) != sizeof(header) ||
+            memcmp_P(header, qoiMagic, 4) != 0) {
+        return false;
+    }
+    width = (uint32_t)header[4] << 24 | (uint32_t)header[5] << 16 | header[6] << 8 | header[7];
+    height = (uint32_t)header[8] << 24 | (uint32_t)header[9] << 16 | header[10] << 8 | header[11];
+    memset(index, 0, sizeof(index));
+    pixel[0] = pixel[1] = pixel[2] = 0;
+    pixel[3] = 255;
+    run = 0;
+    readPos = readLen = 0;
+    return width > 0 && height > 0;
+}
+
+bool QoiDecoder::decodeRow(uint8_t *pBuffer, uint16_t width, uint16_t y)
+{
+    // The pixels beyond the given width are decoded and discarded
+    for (uint32_t x = 0; x < this->width; x++) {
+        if (!decodePixel()) {
+            return false;
+        }
+        if (x < width) {
+            uint8_t color = quantizeColor(pixel, x, y);
+            if (x & 1) {
+                *pBuffer++ |= color;
+            } else {
+                *pBuffer = color << 4;
+            }
+        }
+    }
+    return true;
+}
+
+bool QoiDecoder::decodeRowRGB(uint8_t *pBuffer, uint16_t width)
+{
+    // 3 bytes / pixel without dithering, for the converter on PC
+    for (uint32_t x = 0; x < this->width; x++) {
+        if (!decodePixel()) {
+            return false;
+        }
+        if (x < width) {
+            memcpy(pBuffer, pixel, 3);
+            pBuffer += 3;
+        }
+    }
+    return true;
+}
+
+/*---------------------------------------------------------------------------*/
+
+bool QoiDecoder::decodePixel(void)
+{
+    if (run > 0) {
+        run--;
+        return true;
+    }
+    int16_t op = readByte();
+    if (op < 0) {
+        return false;
+    }
+    if (op == QOI_OP_RGB || op == QOI_OP_RGBA) {
+        for (uint8_t i = 0; i < ((op == QOI_OP_RGB) ? 3 : 4); i++) {
+            int16_t value = readByte();
+            if (value < 0) {
+                return false;
+            }
+            pixel[i] = value;
+        }
+    } else if ((op & QOI_MASK) == QOI_OP_INDEX) {
+        memcpy(pixel, index[op], sizeof(pixel));
+    } else if ((op & QOI_MASK) == QOI_OP_DIFF) {
+        pixel[0] += (op >> 4 & 0x03) - 2;
+        pixel[1] += (op >> 2 & 0x03) - 2;
+        pixel[2] += (op & 0x03) - 2;
+    } else if ((op & QOI_MASK) == QOI_OP_LUMA) {
+        int16_t next = readByte();
+        if (next < 0) {
+            return false;
+        }
+        int8_t dg = (op & 0x3F) - 32;
+        pixel[0] += dg - 8 + (next >> 4 & 0x0F);
+        pixel[1] += dg;
+        pixel[2] += dg - 8 + (next & 0x0F);
+    } else {
+        run = op & 0x3F;
+    }
+    memcpy(index[(pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + pixel[3] * 11) % QOI_INDEX_SIZE],
+            pixel, sizeof(pixel));
+    return true;
+}
+
+int16_t QoiDecoder::readByte(void)
+{
+    if (readPos == readLen) {
+        int len = pFile->read(readBuffer, sizeof(readBuffer));
+        if (len <= 0) {
+            return -1;
+        }
+        readPos = 0;
+        readLen = len;
+    }
+    return readBuffer[readPos++];
+}
+
+/*---------------------------------------------------------------------------*/
+
+static uint8_t quantizeColor(const uint8_t *pPixel, uint16_t x, uint16_t y)
+{
+    // The threshold of the matrix is added to each channel, then the nearest color is taken
+    int16_t offset = pgm_read_byte(&bayerMatrix[y & 3][x & 3]) * DITHER_SPREAD - DITHER_SPREAD * 15 / 2;
+    uint8_t ret = BLACK;
+    uint32_t minDistance = UINT32_MAX;
+    for (uint8_t i = 0; i < ACEP_COLORS; i++) {
+        uint32_t distance = 0;
+        for (uint8_t j = 0; j < 3; j++) {
+            int16_t diff = pPixel[j] + offset - pgm_read_byte(&paletteColors[i][j]);
+            distance += (int32_t)diff * diff;
+        }
+        if (distance < minDistance) {
+            minDistance = distance;
+            ret = i;
+        }
+    }
+    return ret;
+}
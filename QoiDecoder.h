@@ -0,0 +1,59 @@
+/**
+ * ArduinoACePCalendar : "QoiDecoder.h"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <arduino.h>
+#include <SD.h>
+
+#define QOI_HEADER_MAGIC    "qoif"
+#define QOI_INDEX_SIZE      64
+#define QOI_READ_AHEAD      32  // bytes
+
+class QoiDecoder
+{
+public:
+    QoiDecoder() : pFile(NULL), width(0), height(0)
+    {}
+    ~QoiDecoder()
+    {}
+
+    bool begin(File &file);
+    uint32_t getWidth(void) { return width; }
+    uint32_t getHeight(void) { return height; }
+    bool decodeRow(uint8_t *pBuffer, uint16_t width, uint16_t y);
+    bool decodeRowRGB(uint8_t *pBuffer, uint16_t width);
+
+private:
+    bool decodePixel(void);
+    int16_t readByte(void);
+
+    File *pFile;
+    uint32_t width, height;
+    uint8_t index[QOI_INDEX_SIZE][4];
+    uint8_t pixel[4];
+    uint8_t run;
+    uint8_t readBuffer[QOI_READ_AHEAD];
+    uint8_t readPos, readLen;
+};
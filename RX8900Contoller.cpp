@@ -25,6 +25,7 @@
 #include "RX8900Controller.h"
 
 #define I2C_ADDRESS 0x32
+#define I2C_TIMEOUT 25000   // usec
 
 enum : uint8_t {
     REG_SECOND = 0,
@@ -56,6 +57,7 @@ void RX8900Controller::setup(void)
 {
     delay(1000);
     Wire.begin();
+    Wire.setWireTimeout(I2C_TIMEOUT, true); // a stuck bus must not hang the MCU
     uint8_t flag = readByte(REG_FLAG);
     uint8_t data[] = { 0b00101010, 0b00000000, 0b11001001 };
     writeBytes(REG_EXTENTION, data, 3);
@@ -64,6 +66,12 @@ void RX8900Controller::setup(void)
     if (flag & 0b00000010) {
         restoreDefault();
     }
+    updateWeekDay();
+}
+
+bool RX8900Controller::wasReset(void)
+{
+    return isReset;
 }
 
 bool RX8900Controller::getDate(uint16_t &year, uint8_t &month, uint8_t &day)
@@ -88,8 +96,20 @@ bool RX8900Controller::setDate(uint16_t year, uint8_t month, uint8_t day)
     year -= 2000;
     uint8_t data[] = { dec2bcd(day), dec2bcd(month), dec2bcd(year) };
     writeBytes(REG_DAY, data, 3);
+    updateWeekDay();
     return true;
+}
 
+bool RX8900Controller::getWeekDay(uint8_t &weekDay)
+{
+    if (!isInitialized) {
+        return false;
+    }
+    uint8_t week = readByte(REG_WEEK);
+    for (weekDay = 0; weekDay < 6 && !(week & 1 << weekDay); weekDay++) {
+        ;
+    }
+    return true;
 }
 
 bool RX8900Controller::getTime(uint8_t &hour, uint8_t &minute, uint8_t &second)
@@ -127,12 +147,13 @@ bool RX8900Controller::getAlarm(uint8_t &hour, uint8_t &minute)
     return true;
 }
 
-bool RX8900Controller::setAlarm(uint8_t hour, uint8_t minute)
+bool RX8900Controller::setAlarm(uint8_t hour, uint8_t minute, uint8_t weekDays)
 {
-    if (!isInitialized || hour >= 24 || minute >= 60) {
+    if (!isInitialized || hour >= 24 || minute >= 60 || !(weekDays & ALARM_EVERY_DAY)) {
         return false;
     }
-    uint8_t data[] = { dec2bcd(minute), dec2bcd(hour), 0b10000000 };
+    uint8_t youbi = (weekDays & ALARM_EVERY_DAY) == ALARM_EVERY_DAY ? 0b10000000 : weekDays;
+    uint8_t data[] = { dec2bcd(minute), dec2bcd(hour), youbi };
     writeBytes(REG_ALARM_MINUTE, data, 3);
     return true;
 }
@@ -146,17 +167,48 @@ bool RX8900Controller::suspendAlarm(void)
     return true;
 }
 
+bool RX8900Controller::getInterrupts(bool &isAlarm, bool &isTimer)
+{
+    if (!isInitialized) {
+        return false;
+    }
+    uint8_t flag = readByte(REG_FLAG);
+    isAlarm = flag & 0b00001000;
+    isTimer = flag & 0b00010000;
+    return true;
+}
+
+bool RX8900Controller::setTimer(uint16_t minutes)
+{
+    if (!isInitialized || minutes > 4095) {
+        return false;
+    }
+    // The fixed-cycle timer counts the minute updates (TSEL = 1/60 Hz)
+    uint8_t extention = readByte(REG_EXTENTION) & 0b11101100;
+    writeByte(REG_EXTENTION, extention | 0b00000011);
+    if (minutes > 0) {
+        uint8_t data[] = { (uint8_t)(minutes & 0xFF), (uint8_t)(minutes >> 8) };
+        writeBytes(REG_TIMER_COUNTER_0, data, 2);
+        writeByte(REG_EXTENTION, extention | 0b00010011);
+    }
+    uint8_t control = readByte(REG_CONTROL) & 0b11101110;
+    writeByte(REG_CONTROL, control | (minutes > 0 ? 0b00010000 : 0));
+    return true;
+}
+
 uint8_t RX8900Controller::getImageIndex(void)
 {
     return isInitialized ? readByte(REG_RAM) : 0;
 }
 
-bool RX8900Controller::setImageIndex(uint8_t index)
+bool RX8900Controller::setImageIndex(uint16_t index)
 {
+    // Only the low byte is kept in the RAM as the cache of the index in EEPROM
     if (!isInitialized) {
         return false;
     }
-    writeByte(REG_RAM, index);
+    writeByte(REG_RAM, index & 0xFF);
+    return true;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -200,6 +252,23 @@ void RX8900Controller::writeBytes(uint8_t reg, uint8_t *pData, uint8_t len)
     Wire.endTransmission();
 }
 
+void RX8900Controller::updateWeekDay(void)
+{
+    // The week register is used by the alarm, so keep it consistent with the date
+    PROGMEM static const uint8_t monthOffset[12] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+    uint16_t year;
+    uint8_t month, day;
+    if (!getDate(year, month, day) || month == 0 || month > 12) {
+        return;
+    }
+    if (month < 3) {
+        year--;
+    }
+    uint8_t weekDay = (year + year / 4 - year / 100 + year / 400 +
+            pgm_read_byte(&monthOffset[month - 1]) + day) % 7;
+    writeByte(REG_WEEK, 1 << weekDay);
+}
+
 void RX8900Controller::restoreDefault(void)
 {
     writeByte(REG_CONTROL, 0b11000000);
@@ -208,4 +277,5 @@ void RX8900Controller::restoreDefault(void)
     setImageIndex(0);
     setAlarm(3, 30);
     writeByte(REG_CONTROL, 0b11001000);
+    isReset = true;
 }
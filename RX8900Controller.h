@@ -27,30 +27,37 @@
 #include <arduino.h>
 #include <Wire.h>
 
+#define ALARM_EVERY_DAY 0x7F    // bit 0 = Sunday ... bit 6 = Saturday
+
 class RX8900Controller
 {
 public:
-    RX8900Controller() : isInitialized(false)
+    RX8900Controller() : isInitialized(false), isReset(false)
     {}
     ~RX8900Controller()
     {}
 
     void setup(void);
+    bool wasReset(void);
     bool getDate(uint16_t &year, uint8_t &month, uint8_t &day);
     bool setDate(uint16_t year, uint8_t month, uint8_t day);
+    bool getWeekDay(uint8_t &weekDay);
     bool getTime(uint8_t &hour, uint8_t &minute, uint8_t &second);
     bool setTime(uint8_t hour, uint8_t minute, uint8_t second);
     bool getAlarm(uint8_t &hour, uint8_t &minute);
-    bool setAlarm(uint8_t hour, uint8_t minute);
+    bool setAlarm(uint8_t hour, uint8_t minute, uint8_t weekDays = ALARM_EVERY_DAY);
     bool suspendAlarm(void);
+    bool getInterrupts(bool &isAlarm, bool &isTimer);
+    bool setTimer(uint16_t minutes);
     uint8_t getImageIndex(void);
-    bool setImageIndex(uint8_t index);
+    bool setImageIndex(uint16_t index);
 
 private:
     uint8_t readByte(uint8_t reg);
     void readBytes(uint8_t reg, uint8_t *pData, uint8_t len);
     void writeByte(uint8_t reg, uint8_t data);
     void writeBytes(uint8_t reg, uint8_t *pData, uint8_t len);
+    void updateWeekDay(void);
     void restoreDefault(void);
-    bool isInitialized;
+    bool isInitialized, isReset;
 };
@@ -0,0 +1,136 @@
+/**
+ * ArduinoACePCalendar : "ScheduleController.cpp"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ScheduleController.h"
+
+// Times are handled as minutes from Sunday 00:00, and only the next due entry is
+// programmed to the RTC, so the MCU wakes up just when something is to be done.
+// When entries fall on the same time, the one with the larger action is taken, i.e.
+// CLEAN, REDRAW, PHOTO and RETRY in this order, and CLEAN shows the next image if a
+// PHOTO entry is also due.
+
+#define MINUTES_PER_DAY     (24 * 60)
+#define MINUTES_PER_WEEK    (7 * MINUTES_PER_DAY)
+
+PROGMEM static const uint8_t scheduleTable[][4] = {
+    // week days, hour, minute, action
+    { SCHEDULE_EVERY_DAY, SCHEDULE_ALARM_TIME, 0, SCHEDULE_PHOTO },
+    { SCHEDULE_EVERY_DAY, 18, 0, SCHEDULE_RETRY },
+    { SCHEDULE_SUNDAY, 2, 0, SCHEDULE_CLEAN },
+};
+
+/*---------------------------------------------------------------------------*/
+
+void ScheduleController::setAlarmTime(uint8_t hour, uint8_t minute)
+{
+    alarmHour = hour;
+    alarmMinute = minute;
+}
+
+void ScheduleController::getAlarmTime(uint8_t &hour, uint8_t &minute)
+{
+    hour = alarmHour;
+    minute = alarmMinute;
+}
+
+SCHEDULE_ACTION ScheduleController::getDueAction(uint8_t weekDay, uint8_t hour, uint8_t minute)
+{
+    uint8_t index, dueWeekDay;
+    uint16_t now = weekDay * MINUTES_PER_DAY + hour * 60 + minute;
+    if (findEntry(now, false, index, dueWeekDay) > SCHEDULE_DUE_MARGIN) {
+        return SCHEDULE_NONE;
+    }
+    Entry_T entry;
+    readEntry(index, entry);
+    return entry.action;
+}
+
+bool ScheduleController::isActionDue(SCHEDULE_ACTION action, uint8_t weekDay, uint8_t hour, uint8_t minute)
+{
+    uint8_t index, dueWeekDay;
+    uint16_t now = weekDay * MINUTES_PER_DAY + hour * 60 + minute;
+    return findEntry(now, false, index, dueWeekDay, action) <= SCHEDULE_DUE_MARGIN;
+}
+
+SCHEDULE_ACTION ScheduleController::getNextEntry(uint8_t weekDay, uint8_t hour, uint8_t minute,
+        uint8_t &nextWeekDay, uint8_t &nextHour, uint8_t &nextMinute)
+{
+    uint8_t index;
+    uint16_t now = weekDay * MINUTES_PER_DAY + hour * 60 + minute;
+    findEntry(now, true, index, nextWeekDay);
+    Entry_T entry;
+    readEntry(index, entry);
+    nextHour = entry.hour;
+    nextMinute = entry.minute;
+    return entry.action;
+}
+
+/*---------------------------------------------------------------------------*/
+
+void ScheduleController::readEntry(uint8_t i, Entry_T &entry)
+{
+    entry.weekDays = pgm_read_byte(&scheduleTable[i][0]);
+    entry.hour = pgm_read_byte(&scheduleTable[i][1]);
+    entry.minute = pgm_read_byte(&scheduleTable[i][2]);
+    entry.action = (SCHEDULE_ACTION)pgm_read_byte(&scheduleTable[i][3]);
+    if (entry.hour == SCHEDULE_ALARM_TIME) {
+        entry.hour = alarmHour;
+        entry.minute = alarmMinute;
+    }
+}
+
+uint16_t ScheduleController::findEntry(
+        uint16_t now, bool isForward, uint8_t &index, uint8_t &weekDay, SCHEDULE_ACTION action)
+{
+    // Forward: the first entry after now, backward: the latest entry at or before now.
+    // Only the entries of the action are looked for unless it is SCHEDULE_NONE.
+    uint16_t minDistance = MINUTES_PER_WEEK + 1;
+    SCHEDULE_ACTION minAction = SCHEDULE_NONE;
+    index = 0;
+    weekDay = 0;
+    for (uint8_t i = 0; i < sizeof(scheduleTable) / sizeof(scheduleTable[0]); i++) {
+        Entry_T entry;
+        readEntry(i, entry);
+        if (action != SCHEDULE_NONE && entry.action != action) {
+            continue;
+        }
+        for (uint8_t day = 0; day < 7; day++) {
+            if (!(entry.weekDays & 1 << day)) {
+                continue;
+            }
+            uint16_t time = day * MINUTES_PER_DAY + entry.hour * 60 + entry.minute;
+            uint16_t distance = isForward ? time - now : now - time;
+            if ((int16_t)distance < 0 || (isForward && distance == 0)) {
+                distance += MINUTES_PER_WEEK;
+            }
+            if (distance < minDistance || (distance == minDistance && entry.action > minAction)) {
+                minDistance = distance;
+                minAction = entry.action;
+                index = i;
+                weekDay = day;
+            }
+        }
+    }
+    return minDistance;
+}
@@ -0,0 +1,71 @@
+/**
+ * ArduinoACePCalendar : "ScheduleController.h"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <arduino.h>
+
+enum SCHEDULE_ACTION : uint8_t
+{
+    SCHEDULE_NONE = 0,
+    SCHEDULE_RETRY,     // display the current image again only if the last display failed
+    SCHEDULE_PHOTO,     // display the next image
+    SCHEDULE_REDRAW,    // display the current image again
+    SCHEDULE_CLEAN,     // cycle all colors to clear the ghost, then redraw
+};
+
+#define SCHEDULE_EVERY_DAY  0x7F    // bit 0 = Sunday ... bit 6 = Saturday
+#define SCHEDULE_SUNDAY     0x01
+#define SCHEDULE_ALARM_TIME 0xFF    // use the time set by ALARM command
+#define SCHEDULE_DUE_MARGIN 5       // minutes
+
+class ScheduleController
+{
+public:
+    ScheduleController() : alarmHour(3), alarmMinute(30)
+    {}
+    ~ScheduleController()
+    {}
+
+    void setAlarmTime(uint8_t hour, uint8_t minute);
+    void getAlarmTime(uint8_t &hour, uint8_t &minute);
+    SCHEDULE_ACTION getDueAction(uint8_t weekDay, uint8_t hour, uint8_t minute);
+    bool isActionDue(SCHEDULE_ACTION action, uint8_t weekDay, uint8_t hour, uint8_t minute);
+    SCHEDULE_ACTION getNextEntry(uint8_t weekDay, uint8_t hour, uint8_t minute,
+            uint8_t &nextWeekDay, uint8_t &nextHour, uint8_t &nextMinute);
+
+private:
+    typedef struct {
+        uint8_t         weekDays;
+        uint8_t         hour;
+        uint8_t         minute;
+        SCHEDULE_ACTION action;
+    } Entry_T;
+
+    void readEntry(uint8_t i, Entry_T &entry);
+    uint16_t findEntry(uint16_t now, bool isForward, uint8_t &index, uint8_t &weekDay,
+            SCHEDULE_ACTION action = SCHEDULE_NONE);
+
+    uint8_t alarmHour, alarmMinute;
+};
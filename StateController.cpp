@@ -0,0 +1,255 @@
+/**
+ * ArduinoACePCalendar : "StateController.cpp"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <EEPROM.h>
+#include <util/crc16.h>
+#include "StateController.h"
+
+// The records are appended to the slots in turn to level the wear of EEPROM,
+// and the valid record with the latest sequence number is used.
+
+#define RECORD_VERSION  1
+#define SLOT_COUNT      ((E2END + 1) / sizeof(Record_T))
+
+#define FLAG_ALARM      0x01
+#define FLAG_COLOR_MAP  0x02
+#define FLAG_SHUFFLE    0x04
+
+#define COLOR_MAP_LEN   7
+
+/*---------------------------------------------------------------------------*/
+
+void StateController::setup(void)
+{
+    bool isFound = false;
+    Record_T record;
+    for (uint8_t i = 0; i < SLOT_COUNT; i++) {
+        if (readRecord(i, record) && (!isFound || (int16_t)(record.sequence - state.sequence) > 0)) {
+            state = record;
+            slot = i;
+            isFound = true;
+        }
+    }
+    if (!isFound) {
+        memset(&state, 0, sizeof(state));
+        state.version = RECORD_VERSION;
+        slot = SLOT_COUNT - 1;
+    }
+    isLoaded = isFound;
+    isModified = false;
+}
+
+bool StateController::hasRecord(void)
+{
+    return isLoaded;
+}
+
+uint16_t StateController::getImageIndex(void)
+{
+    return state.imageIndex;
+}
+
+void StateController::setImageIndex(uint16_t index)
+{
+    if (state.imageIndex != index) {
+        state.imageIndex = index;
+        isModified = true;
+    }
+}
+
+bool StateController::getAlarm(uint8_t &hour, uint8_t &minute)
+{
+    if (!(state.flags & FLAG_ALARM)) {
+        return false;
+    }
+    hour = state.alarmHour;
+    minute = state.alarmMinute;
+    return true;
+}
+
+void StateController::setAlarm(uint8_t hour, uint8_t minute)
+{
+    state.alarmHour = hour;
+    state.alarmMinute = minute;
+    state.flags |= FLAG_ALARM;
+    isModified = true;
+}
+
+uint16_t StateController::getDisplayCount(void)
+{
+    return state.displayCount;
+}
+
+void StateController::countDisplay(void)
+{
+    state.displayCount++;
+    isModified = true;
+}
+
+uint8_t StateController::getClockInterval(void)
+{
+    return state.clockInterval;
+}
+
+void StateController::setClockInterval(uint8_t interval)
+{
+    if (state.clockInterval != interval) {
+        state.clockInterval = interval;
+        isModified = true;
+    }
+}
+
+uint8_t StateController::getLayout(void)
+{
+    return state.layout;
+}
+
+void StateController::setLayout(uint8_t layout)
+{
+    if (state.layout != layout) {
+        state.layout = layout;
+        isModified = true;
+    }
+}
+
+bool StateController::getColorMap(uint8_t *pMap)
+{
+    if (!(state.flags & FLAG_COLOR_MAP)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < COLOR_MAP_LEN; i++) {
+        pMap[i] = (i & 1) ? state.colorMap[i / 2] & 0x0F : state.colorMap[i / 2] >> 4;
+    }
+    return true;
+}
+
+void StateController::setColorMap(const uint8_t *pMap)
+{
+    memset(state.colorMap, 0, sizeof(state.colorMap));
+    if (pMap) {
+        for (uint8_t i = 0; i < COLOR_MAP_LEN; i++) {
+            state.colorMap[i / 2] |= (i & 1) ? pMap[i] & 0x0F : pMap[i] << 4;
+        }
+        state.flags |= FLAG_COLOR_MAP;
+    } else {
+        state.flags &= ~FLAG_COLOR_MAP;
+    }
+    isModified = true;
+}
+
+bool StateController::getShuffle(uint16_t &seed)
+{
+    if (!(state.flags & FLAG_SHUFFLE)) {
+        return false;
+    }
+    seed = state.shuffleSeed;
+    return true;
+}
+
+void StateController::setShuffle(bool isShuffled, uint16_t seed)
+{
+    if (isShuffled) {
+        state.shuffleSeed = seed;
+        state.flags |= FLAG_SHUFFLE;
+    } else {
+        state.flags &= ~FLAG_SHUFFLE;
+    }
+    isModified = true;
+}
+
+void StateController::renewShuffleSeed(void)
+{
+    // The next round has another order without storing any table
+    state.shuffleSeed = state.shuffleSeed * 31421U + 6927U;
+    isModified = true;
+}
+
+uint8_t StateController::getFaultCount(FAULT_PHASE phase)
+{
+    return (phase < FAULT_PHASE_MAX) ? state.faultCounts[phase] : 0;
+}
+
+FAULT_PHASE StateController::getLastFault(void)
+{
+    return (FAULT_PHASE)state.lastFault;
+}
+
+void StateController::recordFault(FAULT_PHASE phase)
+{
+    if (phase == FAULT_NONE || phase >= FAULT_PHASE_MAX) {
+        return;
+    }
+    if (state.faultCounts[phase] < UINT8_MAX) {
+        state.faultCounts[phase]++;
+    }
+    state.lastFault = phase;
+    isModified = true;
+}
+
+void StateController::clearFaults(void)
+{
+    memset(state.faultCounts, 0, sizeof(state.faultCounts));
+    state.lastFault = FAULT_NONE;
+    isModified = true;
+}
+
+bool StateController::save(void)
+{
+    if (!isModified) {
+        return true;
+    }
+    if (++slot >= SLOT_COUNT) {
+        slot = 0;
+    }
+    state.sequence++;
+    state.crc = calculateCrc(state);
+
+    // The CRC is written at last, so an interrupted record is never adopted
+    const uint8_t *p = (const uint8_t *)&state;
+    uint16_t addr = slot * sizeof(Record_T);
+    for (uint8_t i = 0; i < sizeof(Record_T); i++) {
+        EEPROM.update(addr + i, *p++);
+    }
+    isModified = false;
+    Record_T record;
+    return readRecord(slot, record) && record.sequence == state.sequence;
+}
+
+/*---------------------------------------------------------------------------*/
+
+uint16_t StateController::calculateCrc(const Record_T &record)
+{
+    const uint8_t *p = (const uint8_t *)&record;
+    uint16_t crc = 0xFFFF;
+    for (uint8_t i = 0; i < sizeof(Record_T) - sizeof(record.crc); i++) {
+        crc = _crc16_update(crc, *p++);
+    }
+    return crc;
+}
+
+bool StateController::readRecord(uint8_t slot, Record_T &record)
+{
+    EEPROM.get(slot * sizeof(Record_T), record);
+    return record.version == RECORD_VERSION && record.crc == calculateCrc(record);
+}
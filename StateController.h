@@ -0,0 +1,95 @@
+/**
+ * ArduinoACePCalendar : "StateController.h"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <arduino.h>
+
+enum FAULT_PHASE : uint8_t
+{
+    FAULT_NONE = 0,
+    FAULT_RTC,
+    FAULT_PANEL,
+    FAULT_SCAN,
+    FAULT_DISPLAY,
+    FAULT_PHASE_MAX,
+};
+
+class StateController
+{
+public:
+    StateController() : slot(0), isLoaded(false), isModified(false)
+    {}
+    ~StateController()
+    {}
+
+    void setup(void);
+    bool hasRecord(void);
+    uint16_t getImageIndex(void);
+    void setImageIndex(uint16_t index);
+    bool getAlarm(uint8_t &hour, uint8_t &minute);
+    void setAlarm(uint8_t hour, uint8_t minute);
+    uint16_t getDisplayCount(void);
+    void countDisplay(void);
+    uint8_t getClockInterval(void);
+    void setClockInterval(uint8_t interval);
+    uint8_t getLayout(void);
+    void setLayout(uint8_t layout);
+    bool getColorMap(uint8_t *pMap);
+    void setColorMap(const uint8_t *pMap);
+    bool getShuffle(uint16_t &seed);
+    void setShuffle(bool isShuffled, uint16_t seed = 0);
+    void renewShuffleSeed(void);
+    uint8_t getFaultCount(FAULT_PHASE phase);
+    FAULT_PHASE getLastFault(void);
+    void recordFault(FAULT_PHASE phase);
+    void clearFaults(void);
+    bool save(void);
+
+private:
+    typedef struct {
+        uint16_t    sequence;
+        uint8_t     version;
+        uint8_t     flags;
+        uint16_t    imageIndex;
+        uint8_t     alarmHour;
+        uint8_t     alarmMinute;
+        uint16_t    displayCount;
+        uint8_t     faultCounts[FAULT_PHASE_MAX];
+        uint8_t     lastFault;
+        uint8_t     clockInterval;
+        uint8_t     layout;
+        uint8_t     colorMap[4];    // 2 colors / byte
+        uint16_t    shuffleSeed;
+        uint8_t     reserved[6];
+        uint16_t    crc;
+    } Record_T;
+
+    uint16_t calculateCrc(const Record_T &record);
+    bool readRecord(uint8_t slot, Record_T &record);
+
+    Record_T state;
+    uint8_t slot;
+    bool isLoaded, isModified;
+};
@@ -0,0 +1,133 @@
+/**
+ * ArduinoACePCalendar : "TaskController.cpp"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <avr/sleep.h>
+#include "TaskController.h"
+
+/*---------------------------------------------------------------------------*/
+
+bool TaskController::addTimerTask(void (*pFunc)(void), uint32_t interval)
+{
+    if (!addTask(pFunc, TASK_TIMER)) {
+        return false;
+    }
+    tasks[taskCount - 1].interval = interval;
+    return true;
+}
+
+bool TaskController::addPinTask(void (*pFunc)(void), uint8_t pin)
+{
+    if (!addTask(pFunc, TASK_PIN)) {
+        return false;
+    }
+    tasks[taskCount - 1].pin = pin;
+    return true;
+}
+
+bool TaskController::addEventTask(void (*pFunc)(void), bool (*pCondition)(void))
+{
+    if (!pCondition || !addTask(pFunc, TASK_EVENT)) {
+        return false;
+    }
+    tasks[taskCount - 1].pCondition = pCondition;
+    return true;
+}
+
+void TaskController::run(void)
+{
+    uint32_t now = millis();
+    uint32_t deadline = 0;
+    bool hasDeadline = false;
+    for (Task_T *pTask = tasks; pTask < tasks + taskCount; pTask++) {
+        if (isTriggered(pTask, now)) {
+            pTask->lastTime = now;
+            pTask->pFunc();
+            now = millis();
+        }
+        if (pTask->type == TASK_TIMER) {
+            uint32_t taskDeadline = pTask->lastTime + pTask->interval;
+            if (!hasDeadline || (int32_t)(taskDeadline - deadline) < 0) {
+                deadline = taskDeadline;
+                hasDeadline = true;
+            }
+        }
+    }
+    sleepUntil(deadline, hasDeadline);
+}
+
+/*---------------------------------------------------------------------------*/
+
+bool TaskController::addTask(void (*pFunc)(void), TASK_TYPE type)
+{
+    if (!pFunc || taskCount >= TASK_MAX) {
+        return false;
+    }
+    Task_T *pTask = &tasks[taskCount++];
+    pTask->pFunc = pFunc;
+    pTask->type = type;
+    pTask->lastTime = millis();
+    return true;
+}
+
+bool TaskController::isTriggered(Task_T *pTask, uint32_t now)
+{
+    switch (pTask->type) {
+        case TASK_TIMER:
+            return now - pTask->lastTime >= pTask->interval;
+        case TASK_PIN:
+            return digitalRead(pTask->pin) == LOW;
+        case TASK_EVENT:
+            return pTask->pCondition();
+        default:
+            return false;
+    }
+}
+
+bool TaskController::isAnyTriggered(uint32_t now)
+{
+    for (Task_T *pTask = tasks; pTask < tasks + taskCount; pTask++) {
+        if (isTriggered(pTask, now)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskController::sleepUntil(uint32_t deadline, bool hasDeadline)
+{
+    // Idle sleep is woken by any interrupt (timer 0 tick, USART, pins, ...).
+    // Timer 0 keeps millis() running and wakes the MCU every 1 msec, so this only saves
+    // the power of the CPU clock. Power-down can't be used here because it would stop
+    // millis() and the USART receiver, and the shell timeout is what leads to power-down.
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    while (true) {
+        uint32_t now = millis();
+        if ((hasDeadline && (int32_t)(deadline - now) <= 0) || isAnyTriggered(now)) {
+            break;
+        }
+        sleep_enable();
+        sleep_cpu();
+        sleep_disable();
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * ArduinoACePCalendar : "TaskController.h"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <arduino.h>
+
+#define TASK_MAX    6
+
+enum TASK_TYPE : uint8_t
+{
+    TASK_TIMER = 0,
+    TASK_PIN,
+    TASK_EVENT,
+};
+
+class TaskController
+{
+public:
+    TaskController() : taskCount(0)
+    {}
+    ~TaskController()
+    {}
+
+    bool addTimerTask(void (*pFunc)(void), uint32_t interval);
+    bool addPinTask(void (*pFunc)(void), uint8_t pin);
+    bool addEventTask(void (*pFunc)(void), bool (*pCondition)(void));
+    void run(void);
+
+private:
+    typedef struct {
+        void        (*pFunc)(void);
+        TASK_TYPE   type;
+        union {
+            uint32_t    interval;
+            uint8_t     pin;
+            bool        (*pCondition)(void);
+        };
+        uint32_t    lastTime;
+    } Task_T;
+
+    bool addTask(void (*pFunc)(void), TASK_TYPE type);
+    bool isTriggered(Task_T *pTask, uint32_t now);
+    bool isAnyTriggered(uint32_t now);
+    void sleepUntil(uint32_t deadline, bool hasDeadline);
+
+    Task_T tasks[TASK_MAX];
+    uint8_t taskCount;
+};
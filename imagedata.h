@@ -45,6 +45,8 @@ enum : uint8_t {
     IMG_ID_KANJI_YEAR,
     IMG_ID_BRACKET_L,
     IMG_ID_BRACKET_R,
+    IMG_ID_COLON,
+    IMG_ID_COUNT,
     IMG_ID_KANJI_DAY = IMG_ID_KANJI_SUN,
     IMG_ID_KANJI_MONTH = IMG_ID_KANJI_MON,
     IMG_ID_BLANK = 255,
@@ -55,430 +57,260 @@ enum : uint8_t {
 #define IMG_KANJI_H     32
 #define IMG_KANJI_OFFS  (IMG_NUMBER_H - IMG_KANJI_H)
 
-PROGMEM static const uint8_t imgNumber[10][384] = { // 32x48 (4 pixels / byte) x10
-    {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x02, 0x00, 0x00,
-        0x00, 0x00, 0xA0, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xAB, 0x02, 0x00,
-        0x00, 0x80, 0xFA, 0xFF, 0xFF, 0xBF, 0x0A, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00,
-        0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0xBF, 0xFE, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0xAF, 0xE8, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0xBF, 0xFE, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00,
-        0x00, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xA0, 0xFE, 0xFF, 0xFF, 0xBF, 0x02, 0x00,
-        0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0xAA, 0x2A, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFE, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xEA, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xAA, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0xA8, 0xEA, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
-        0x80, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x80, 0xFE, 0xAB, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xA8, 0x82, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0xAA, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0x02, 0x00, 0x00,
-        0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xA0, 0xEA, 0xFF, 0xFF, 0xAB, 0x02, 0x00,
-        0x00, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x80, 0xFE, 0xAF, 0xAA, 0xFF, 0xFF, 0xFF, 0x2B,
-        0x80, 0xFE, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0x2B, 0x80, 0xBE, 0x0A, 0x00, 0xFA, 0xFF, 0xFF, 0x2B,
-        0x80, 0xAE, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B, 0x00, 0x2A, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B,
-        0x00, 0x08, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A,
-        0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0x0A,
-        0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0xA0, 0xFE, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0x00, 0xA8, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xAB, 0x00, 0x00,
-        0x00, 0xE8, 0xFF, 0xFF, 0xBF, 0x2A, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00,
-        0x80, 0xFE, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xBF, 0xAA, 0xAA, 0xAA, 0x02,
-        0xA0, 0xFF, 0xFF, 0xAF, 0xAA, 0xAA, 0xAA, 0x0A, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B,
-        0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-        0x00, 0xA8, 0xAA, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0xAA, 0xFE, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0x0A, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x80, 0xBE, 0xAA, 0xEA, 0xFF, 0xFF, 0xFF, 0x0A,
-        0x00, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x28, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A,
-        0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A,
-        0x00, 0x00, 0xAA, 0xAA, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x80, 0xAA, 0xEA, 0xFF, 0xFF, 0xBF, 0x02,
-        0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00,
-        0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xBF, 0x0A, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xAF, 0x0A, 0x00,
-        0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0x00, 0x80, 0xAA, 0xEA, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0x2B,
-        0x00, 0x00, 0x00, 0x80, 0xFA, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B,
-        0x00, 0x0A, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B, 0x80, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0x2B,
-        0xA0, 0xAF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x2B, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x0A, 0x00,
-        0x80, 0xAA, 0xFF, 0xFF, 0xBF, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0x00, 0x00,
-        0x00, 0x00, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0x2A, 0x00,
-        0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFE, 0xFF, 0xAF, 0x00,
-        0x00, 0xA0, 0xFF, 0xFF, 0xFE, 0xFF, 0xAF, 0x00, 0x00, 0xE8, 0xFF, 0xBF, 0xFE, 0xFF, 0xAF, 0x00,
-        0x00, 0xFA, 0xFF, 0xBF, 0xFE, 0xFF, 0xAF, 0x00, 0x80, 0xFE, 0xFF, 0xAF, 0xFE, 0xFF, 0xAF, 0x00,
-        0xA0, 0xFF, 0xFF, 0xAF, 0xFE, 0xFF, 0xAF, 0x00, 0xA0, 0xFF, 0xFF, 0xAB, 0xFE, 0xFF, 0xAF, 0x00,
-        0xE8, 0xFF, 0xFF, 0xAB, 0xFE, 0xFF, 0xAF, 0x00, 0xFA, 0xFF, 0xFF, 0xAA, 0xFE, 0xFF, 0xAF, 0x0A,
-        0xFA, 0xFF, 0xBF, 0xAA, 0xFE, 0xFF, 0xAF, 0x2A, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
-        0xA8, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xAF, 0x2A, 0xA0, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xAF, 0x0A,
-        0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xAF, 0x00,
-        0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xAF, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0x0A, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0x00,
-        0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0xFA, 0xFF, 0xBF, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0xFA, 0xFF, 0xBF, 0xAA, 0xAA, 0x0A, 0x00,
-        0x00, 0xFA, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xBF, 0xAA, 0x0A, 0x00, 0x00,
-        0x00, 0xFA, 0xFF, 0xBF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xBF, 0xFF, 0xAF, 0x0A, 0x00,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B,
-        0x00, 0xAA, 0xAA, 0xEA, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0xA8, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0x2B,
-        0x00, 0x00, 0x00, 0x80, 0xFA, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B,
-        0x00, 0x0A, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B, 0x80, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xFF, 0x2B,
-        0xA0, 0xAF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x0A, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00,
-        0x80, 0xAA, 0xFF, 0xFF, 0xBF, 0x2A, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x00,
-        0x00, 0x00, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0x0A, 0x00,
-        0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0xA0, 0xEA, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0x00, 0xA8, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x80, 0xFE, 0xFF, 0xFF, 0xAF, 0xAA, 0xBE, 0x02,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0x00, 0xA0, 0xFF, 0xFF, 0xBF, 0x0A, 0x00, 0x28, 0x00,
-        0xA0, 0xFF, 0xFF, 0xAF, 0xA8, 0xAA, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xAF, 0xAA, 0xAA, 0x0A, 0x00,
-        0xE8, 0xFF, 0xFF, 0xAB, 0xFE, 0xFF, 0x2A, 0x00, 0xE8, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xAF, 0x00,
-        0xFA, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0x02, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B,
-        0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xE8, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF,
-        0xE8, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0xBF, 0xFA, 0xFF, 0xFF, 0x2B, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xBF, 0x0A, 0x00,
-        0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xAA, 0x02, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0xAA, 0x2A, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A,
-        0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
-        0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
-        0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
-        0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B,
-        0xA0, 0xAA, 0xAA, 0xAA, 0xEA, 0xFF, 0xFF, 0x2B, 0x80, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0x0A,
-        0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xBF, 0x02,
-        0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B, 0x00,
-        0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xBF, 0x02, 0x00,
-        0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
-        0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
-        0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B, 0x00, 0x00,
-        0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x2B, 0x00, 0x00,
-        0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
-        0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00,
-        0x00, 0xA0, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00,
-        0x00, 0xE8, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00,
-        0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xA8, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xFF, 0xFF, 0xAA, 0x02, 0x00,
-        0x00, 0xA0, 0xFE, 0xFF, 0xFF, 0xBF, 0x0A, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00,
-        0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0xE8, 0xFF, 0xFF, 0xAF, 0xFE, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0x2B, 0xA0, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0x0A,
-        0xA0, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x0A, 0x80, 0xFE, 0xFF, 0xBF, 0xFE, 0xFF, 0xBF, 0x02,
-        0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0x00, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00,
-        0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xFA, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x0A, 0xA0, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B,
-        0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0x00, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00,
-        0x00, 0x80, 0xEA, 0xFF, 0xFF, 0xAB, 0x02, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00,
-        0x00, 0x00, 0x80, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xA8, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
-        0x00, 0xA0, 0xFE, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
-        0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
-        0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x0A,
-        0xFA, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0x2B,
-        0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0x2B, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0x2B, 0xE8, 0xFF, 0xFF, 0xAF,
-        0xFA, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xAF,
-        0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF,
-        0x80, 0xFE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xAF, 0x00, 0xEA, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xAF,
-        0x00, 0xA8, 0xFE, 0xBF, 0xEA, 0xFF, 0xFF, 0x2B, 0x00, 0x80, 0xAA, 0xAA, 0xEA, 0xFF, 0xFF, 0x2B,
-        0x00, 0x00, 0xA8, 0x2A, 0xFA, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x2B,
-        0x00, 0x0A, 0x00, 0xA0, 0xFE, 0xFF, 0xFF, 0x0A, 0x80, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x0A,
-        0xA0, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF, 0xBF, 0x02, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x0A, 0x00,
-        0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00,
-        0x80, 0xEA, 0xFF, 0xFF, 0xAB, 0x0A, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-        0x00, 0x80, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }
+#define IMG_RUN_OPAQUE  0x80
+#define IMG_RUN_FG      0x40
+#define IMG_RUN_LEN     0x3F
+
+PROGMEM static const uint16_t imgGlyphOffset[21] = {
+    0, 184, 306, 528, 752, 932, 1129, 1361, 1521, 1706,
+    1933, 1995, 2141, 2424, 2703, 2889, 3073, 3134, 3285, 3336,
+    3387,
 };
 
-PROGMEM static const uint8_t imgKanji[10][256] = { // 32x32 (4 pixels / byte) x10
-    {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
-        0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
-        0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
-        0x00, 0xFE, 0xAF, 0xAA, 0xAA, 0xFA, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0x00,
-        0x00, 0xFE, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0x00,
-        0x00, 0xFE, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0x00,
-        0x00, 0xFE, 0xAF, 0xAA, 0xAA, 0xFA, 0xBF, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
-        0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
-        0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFE, 0xAF, 0xAA, 0xAA, 0xFA, 0xBF, 0x00,
-        0x00, 0xFE, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0x00,
-        0x00, 0xFE, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0x00,
-        0x00, 0xFE, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0x00, 0x00, 0xFE, 0xAF, 0xAA, 0xAA, 0xFA, 0xBF, 0x00,
-        0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
-        0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
-        0x00, 0xFE, 0xAF, 0xAA, 0xAA, 0xFA, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0x00,
-        0x00, 0xAA, 0x2A, 0x00, 0x00, 0xA8, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0x00,
-        0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
-        0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
-        0x00, 0xE0, 0xBF, 0xAA, 0xAA, 0xFE, 0x2F, 0x00, 0x00, 0xE0, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0x00,
-        0x00, 0xE0, 0xBF, 0xAA, 0xAA, 0xFE, 0x2F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
-        0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
-        0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xE0, 0xBF, 0xAA, 0xAA, 0xFE, 0x2F, 0x00,
-        0x00, 0xE0, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0xE0, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0x00,
-        0x00, 0xE0, 0xBF, 0xAA, 0xAA, 0xFE, 0x2F, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
-        0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
-        0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF8, 0xBF, 0xAA, 0xAA, 0xFE, 0x2F, 0x00,
-        0x00, 0xFE, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x80, 0xFF, 0x2F, 0x00, 0x00, 0xFE, 0x2F, 0x00,
-        0xE0, 0xFF, 0x2F, 0x80, 0xAA, 0xFE, 0x2F, 0x00, 0xF8, 0xFF, 0x0B, 0x80, 0xFF, 0xFF, 0x2F, 0x00,
-        0xE0, 0xFF, 0x0B, 0x00, 0xFE, 0xFF, 0x2F, 0x00, 0xE0, 0xFF, 0x02, 0x00, 0xFE, 0xFF, 0x2F, 0x00,
-        0x80, 0xBF, 0x00, 0x00, 0xFE, 0xFF, 0x0B, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xF8, 0xFF, 0x02, 0x00,
-        0x00, 0x08, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0xA0, 0x02, 0xF8, 0x2F, 0x00, 0x0A, 0x00, 0x00, 0xF8, 0x0B, 0xF8, 0x2F, 0x80, 0xAF, 0x00,
-        0x00, 0xFE, 0x2F, 0xF8, 0x2F, 0x80, 0xFF, 0x02, 0x00, 0xFE, 0x2F, 0xFE, 0x2F, 0xE0, 0xFF, 0x0B,
-        0x00, 0xFE, 0x2F, 0xFE, 0x2F, 0xE0, 0xFF, 0x02, 0x00, 0xFE, 0x2F, 0xFE, 0x2F, 0xF8, 0xFF, 0x02,
-        0x80, 0xFF, 0x0B, 0xFE, 0x2F, 0xFE, 0xBF, 0x00, 0x80, 0xFF, 0x0B, 0xFE, 0xAF, 0xFF, 0x2F, 0x00,
-        0x80, 0xFF, 0x0B, 0xFE, 0xBF, 0xFF, 0x2F, 0x00, 0xE0, 0xFF, 0x0B, 0xFE, 0xBF, 0xFA, 0x0B, 0x00,
-        0xA0, 0xFA, 0x82, 0xFF, 0xFF, 0xE2, 0x02, 0x00, 0x00, 0xA0, 0x80, 0xFF, 0xFF, 0x82, 0x00, 0x00,
-        0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
-        0x00, 0x00, 0xF8, 0xBF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0xFE, 0xBF, 0x00, 0x00,
-        0x00, 0xA0, 0xFF, 0x2F, 0xF8, 0xFF, 0x02, 0x00, 0x00, 0xF8, 0xFF, 0x0B, 0xF8, 0xFF, 0x2B, 0x00,
-        0xA0, 0xFE, 0xFF, 0x02, 0xE0, 0xFF, 0xBF, 0x02, 0xF8, 0xFF, 0xBF, 0x00, 0x80, 0xFF, 0xFF, 0x0B,
-        0xFE, 0xFF, 0x2F, 0x00, 0x00, 0xFE, 0xFF, 0x2F, 0xF8, 0xFF, 0x0B, 0x00, 0x00, 0xE8, 0xFF, 0x2F,
-        0xE0, 0xBF, 0x02, 0x00, 0x00, 0x80, 0xFF, 0x0B, 0xE0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x0B,
-        0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x2E, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0xBF, 0x80, 0xBF, 0x00, 0xA8, 0xAA, 0xAA, 0xFA, 0xBF, 0xE0, 0xFF, 0x02,
-        0xF8, 0xFF, 0xFF, 0xFB, 0xBF, 0xF8, 0xFF, 0x0B, 0xF8, 0xFF, 0xFF, 0xFB, 0xFF, 0xFA, 0xFF, 0x02,
-        0xF8, 0xFF, 0xFF, 0xFB, 0xFF, 0xFE, 0xBF, 0x00, 0xF8, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x2F, 0x00,
-        0xA8, 0xAA, 0xFE, 0xFB, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x80, 0xFF, 0xFB, 0xFF, 0xFF, 0x02, 0x00,
-        0x00, 0x80, 0xFF, 0xFB, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFB, 0xFF, 0xBF, 0x00, 0x00,
-        0x00, 0xE0, 0xFF, 0xFA, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFA, 0xEF, 0xFF, 0x02, 0x00,
-        0x00, 0xF8, 0xFF, 0xFA, 0xEF, 0xFF, 0x0B, 0x00, 0x00, 0xFE, 0xBF, 0xF8, 0xAF, 0xFF, 0x2F, 0x00,
-        0x80, 0xFF, 0xBF, 0xF8, 0x2F, 0xFE, 0xBF, 0x00, 0xE0, 0xFF, 0x2F, 0xF8, 0x2F, 0xFE, 0xFF, 0x2A,
-        0xF8, 0xFF, 0x2F, 0xF8, 0x2F, 0xF8, 0xFF, 0x2F, 0xF8, 0xFF, 0x0B, 0xF8, 0x2F, 0xE0, 0xFF, 0x2F,
-        0xF8, 0xFF, 0xAA, 0xFA, 0x2F, 0x80, 0xFF, 0x2F, 0xE0, 0xBF, 0xF8, 0xFF, 0x2F, 0x00, 0xFE, 0x0B,
-        0x80, 0x2F, 0xF8, 0xFF, 0x2F, 0x00, 0xF8, 0x02, 0x00, 0x0A, 0xF8, 0xFF, 0x2F, 0x00, 0xA0, 0x00,
-        0x00, 0x00, 0xE0, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0B, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x80, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00,
-        0xAA, 0xAA, 0xAA, 0xFE, 0xAF, 0xAA, 0xAA, 0x2A, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
-        0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
-        0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xAA, 0xAA, 0xEA, 0xFF, 0xFF, 0xAB, 0xAA, 0x2A,
-        0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
-        0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
-        0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xEF, 0xFF, 0x0B, 0x00,
-        0x00, 0xF8, 0xFF, 0xFE, 0xAF, 0xFF, 0x2F, 0x00, 0x00, 0xFE, 0xFF, 0xFE, 0xAF, 0xFF, 0xBF, 0x02,
-        0xA0, 0xFF, 0xBF, 0xFE, 0x2F, 0xFE, 0xFF, 0x2B, 0xF8, 0xFF, 0x2F, 0xFE, 0x2F, 0xF8, 0xFF, 0xBF,
-        0xFE, 0xFF, 0x0B, 0xFE, 0x2F, 0xE0, 0xFF, 0x2F, 0xF8, 0xFF, 0x02, 0xFE, 0x2F, 0x80, 0xFF, 0x2F,
-        0xE0, 0xBF, 0x00, 0xFE, 0x2F, 0x00, 0xFE, 0x0B, 0x80, 0x2F, 0x00, 0xFE, 0x2F, 0x00, 0xE8, 0x02,
-        0x00, 0x0A, 0x00, 0xFE, 0x2F, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x02, 0x00, 0x00,
-        0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
-        0x00, 0xA0, 0xFF, 0xFF, 0xFE, 0xFF, 0x0A, 0x00, 0x00, 0xFA, 0xFF, 0xAF, 0xF8, 0xFF, 0xAF, 0x00,
-        0xA8, 0xFF, 0xFF, 0x0B, 0xE0, 0xFF, 0xFF, 0xAA, 0xF8, 0xFF, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xBF,
-        0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
-        0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xE0, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x0B,
-        0xA0, 0xAA, 0xAA, 0xFA, 0xAF, 0xAA, 0xAA, 0x0A, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
-        0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
-        0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
-        0xA0, 0xAA, 0xAF, 0xFA, 0xAF, 0xFA, 0xAA, 0x0A, 0x00, 0xF8, 0xBF, 0xF8, 0x2F, 0xF8, 0x2F, 0x00,
-        0x00, 0xF8, 0xBF, 0xF8, 0x2F, 0xFE, 0x2F, 0x00, 0x00, 0xE0, 0xFF, 0xFA, 0x2F, 0xFE, 0x0B, 0x00,
-        0xA8, 0xEA, 0xBF, 0xF8, 0xAF, 0xFF, 0xAB, 0x2A, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
-        0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
-        0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0xFA, 0xAF, 0xAA, 0xAA, 0x02,
-        0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
-        0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
-        0x80, 0xAA, 0xAA, 0xFA, 0xAF, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00,
-        0xA8, 0xAA, 0xAA, 0xFA, 0xAF, 0xAA, 0xAA, 0xAA, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
-        0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
-        0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xE0, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A,
-        0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
-        0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
-        0xEA, 0xFF, 0xAB, 0xEA, 0xFF, 0xAA, 0xAA, 0x0A, 0xFE, 0xFF, 0x02, 0xE0, 0xFF, 0x02, 0x00, 0x00,
-        0xF8, 0xBF, 0xAA, 0xEA, 0xFF, 0xAA, 0xAA, 0x02, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
-        0xE0, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xE0, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
-        0xA0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xF8, 0xBF, 0xEA, 0xFF, 0xAA, 0xAA, 0x02,
-        0x00, 0xF8, 0xBF, 0xE0, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF8, 0xBF, 0xE0, 0xFF, 0x02, 0x00, 0x00,
-        0x00, 0xF8, 0xBF, 0xE0, 0xFF, 0x02, 0x00, 0x00, 0xAA, 0xFA, 0xBF, 0xEA, 0xFF, 0xAA, 0xAA, 0x2A,
-        0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
-        0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
-        0xAA, 0xAA, 0xAA, 0xEA, 0xFF, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x02, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xE0, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x02, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xE0, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x02, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xA0, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAB, 0xAA, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAB, 0xAA, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }, {
-        0xA0, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0xE0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0xE0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xAA, 0xFA, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xAA, 0xFA, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0xE0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0xE0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
-        0xA0, 0xAA, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    }
+PROGMEM static const uint8_t imgGlyphData[3433] = { // row offsets + run data (see fontconvert.py)
+    // Image 0: 384 -> 184 bytes (saved 200), 5.3 runs/row (max 9)
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x0C, 0x11, 0x16, 0x1B, 0x20, 0x25, 0x2A, 0x2F, 0x36, 0x36,
+    0x3D, 0x46, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x36,
+    0x36, 0x36, 0x5D, 0x2A, 0x64, 0x20, 0x69, 0x6E, 0x73, 0x78, 0x7D, 0x82, 0x85, 0x00, 0x00, 0x00,
+    0x1F, 0x0B, 0x88, 0x0A, 0x09, 0x8C, 0x08, 0x07, 0x83, 0xC8, 0x83, 0x06, 0x06, 0x82, 0xCC, 0x82,
+    0x05, 0x05, 0x81, 0xD0, 0x81, 0x04, 0x04, 0x81, 0xD2, 0x81, 0x03, 0x03, 0x81, 0xD4, 0x81, 0x02,
+    0x02, 0x81, 0xD5, 0x81, 0x02, 0x02, 0x81, 0xD6, 0x81, 0x01, 0x01, 0x81, 0xD7, 0x81, 0x01, 0x01,
+    0x81, 0xCA, 0x81, 0xCB, 0x81, 0x00, 0x00, 0x81, 0xCA, 0x83, 0xCA, 0x81, 0x00, 0x00, 0x81, 0xCA,
+    0x81, 0x00, 0x81, 0xC9, 0x81, 0x00, 0x00, 0x81, 0xC9, 0x81, 0x01, 0x81, 0xCA, 0x81, 0x81, 0xCA,
+    0x81, 0x01, 0x81, 0xCA, 0x81, 0x81, 0xCA, 0x81, 0x01, 0x81, 0xC9, 0x81, 0x00, 0x00, 0x81, 0xCB,
+    0x81, 0xCA, 0x81, 0x01, 0x01, 0x81, 0xD6, 0x81, 0x02, 0x03, 0x81, 0xD3, 0x81, 0x03, 0x03, 0x81,
+    0xD2, 0x81, 0x04, 0x04, 0x82, 0xCF, 0x81, 0x05, 0x05, 0x82, 0xCD, 0x81, 0x06, 0x07, 0x83, 0xC7,
+    0x83, 0x07, 0x08, 0x8D, 0x08, 0x0B, 0x87, 0x0B,
+    // Image 1: 384 -> 122 bytes (saved 262), 4.4 runs/row (max 7)
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x0C, 0x11, 0x16, 0x1B, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x25, 0x2C, 0x33, 0x38, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x44, 0x47, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x10, 0x86, 0x07, 0x0E, 0x89, 0x06, 0x0C, 0x83, 0xC6, 0x81, 0x05, 0x0A, 0x83, 0xC8, 0x81,
+    0x05, 0x07, 0x84, 0xCA, 0x81, 0x05, 0x04, 0x85, 0xCC, 0x81, 0x05, 0x03, 0x83, 0xCF, 0x81, 0x05,
+    0x02, 0x81, 0xD2, 0x81, 0x05, 0x02, 0x81, 0xC6, 0x80, 0xCA, 0x81, 0x05, 0x02, 0x81, 0xC3, 0x83,
+    0xCA, 0x81, 0x05, 0x03, 0x88, 0xCA, 0x81, 0x05, 0x04, 0x83, 0x01, 0x81, 0xCA, 0x81, 0x05, 0x0A,
+    0x81, 0xCA, 0x81, 0x05, 0x0B, 0x8C, 0x06, 0x0C, 0x8A, 0x07,
+    // Image 2: 384 -> 222 bytes (saved 162), 4.6 runs/row (max 9)
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x0C, 0x11, 0x16, 0x1B, 0x20, 0x20, 0x25, 0x2A, 0x31, 0x38,
+    0x41, 0x4A, 0x51, 0x58, 0x5D, 0x62, 0x67, 0x6C, 0x71, 0x76, 0x7B, 0x80, 0x85, 0x8A, 0x8F, 0x94,
+    0x99, 0x9E, 0x9E, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA8, 0xAB, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x0A, 0x89, 0x0A, 0x07, 0x8F, 0x07, 0x05, 0x84, 0xC9, 0x83, 0x06, 0x04, 0x82, 0xCF, 0x81,
+    0x05, 0x03, 0x81, 0xD2, 0x81, 0x04, 0x02, 0x81, 0xD4, 0x81, 0x03, 0x02, 0x81, 0xD5, 0x81, 0x02,
+    0x02, 0x81, 0xD6, 0x81, 0x01, 0x02, 0x81, 0xD7, 0x81, 0x00, 0x02, 0x81, 0xC4, 0x85, 0xCC, 0x81,
+    0x00, 0x02, 0x81, 0xC2, 0x88, 0xCB, 0x81, 0x00, 0x02, 0x81, 0xC1, 0x82, 0x05, 0x81, 0xCA, 0x81,
+    0x00, 0x02, 0x81, 0xC0, 0x81, 0x07, 0x81, 0xCA, 0x81, 0x00, 0x03, 0x82, 0x08, 0x81, 0xCA, 0x81,
+    0x00, 0x04, 0x80, 0x09, 0x81, 0xCA, 0x81, 0x00, 0x0E, 0x81, 0xCA, 0x81, 0x01, 0x0D, 0x81, 0xCB,
+    0x81, 0x01, 0x0C, 0x81, 0xCC, 0x81, 0x01, 0x0B, 0x81, 0xCC, 0x81, 0x02, 0x09, 0x82, 0xCC, 0x81,
+    0x03, 0x08, 0x82, 0xCC, 0x81, 0x04, 0x07, 0x81, 0xCD, 0x81, 0x05, 0x06, 0x81, 0xCD, 0x81, 0x06,
+    0x05, 0x81, 0xCC, 0x82, 0x07, 0x04, 0x81, 0xCB, 0x83, 0x08, 0x03, 0x81, 0xCB, 0x82, 0x0A, 0x02,
+    0x81, 0xCA, 0x82, 0x0C, 0x02, 0x81, 0xC9, 0x8D, 0x02, 0x01, 0x81, 0xC9, 0x8F, 0x01, 0x01, 0x81,
+    0xD8, 0x81, 0x00, 0x00, 0x81, 0xD9, 0x81, 0x00, 0x01, 0x9B, 0x01, 0x02, 0x99, 0x02,
+    // Image 3: 384 -> 224 bytes (saved 160), 4.5 runs/row (max 7)
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x0C, 0x11, 0x16, 0x1B, 0x1B, 0x20, 0x20, 0x25, 0x2C, 0x31,
+    0x38, 0x38, 0x3D, 0x42, 0x47, 0x4C, 0x51, 0x56, 0x4C, 0x47, 0x5B, 0x60, 0x65, 0x6A, 0x6F, 0x74,
+    0x79, 0x80, 0x85, 0x8C, 0x8C, 0x8C, 0x91, 0x96, 0x9B, 0xA0, 0xA5, 0xAA, 0xAD, 0x00, 0x00, 0x00,
+    0x1F, 0x08, 0x8A, 0x0B, 0x04, 0x91, 0x08, 0x03, 0x84, 0xCA, 0x83, 0x07, 0x02, 0x81, 0xD1, 0x82,
+    0x05, 0x02, 0x81, 0xD2, 0x82, 0x04, 0x02, 0x81, 0xD4, 0x81, 0x03, 0x02, 0x81, 0xD5, 0x81, 0x02,
+    0x02, 0x81, 0xD6, 0x81, 0x01, 0x02, 0x81, 0xC1, 0x87, 0xCC, 0x81, 0x01, 0x03, 0x8B, 0xCB, 0x81,
+    0x01, 0x04, 0x81, 0x07, 0x81, 0xCA, 0x81, 0x01, 0x0E, 0x81, 0xCA, 0x81, 0x01, 0x07, 0x87, 0xCA,
+    0x81, 0x02, 0x06, 0x87, 0xCB, 0x81, 0x02, 0x05, 0x81, 0xD1, 0x81, 0x03, 0x05, 0x81, 0xD0, 0x81,
+    0x04, 0x05, 0x81, 0xCE, 0x82, 0x05, 0x05, 0x81, 0xCD, 0x83, 0x05, 0x05, 0x81, 0xD2, 0x81, 0x02,
+    0x05, 0x81, 0xD3, 0x81, 0x01, 0x06, 0x87, 0xCC, 0x81, 0x01, 0x07, 0x88, 0xCB, 0x81, 0x00, 0x0E,
+    0x82, 0xCA, 0x81, 0x00, 0x0F, 0x81, 0xCA, 0x81, 0x00, 0x03, 0x81, 0x09, 0x81, 0xCA, 0x81, 0x00,
+    0x02, 0x8D, 0xCB, 0x81, 0x00, 0x01, 0x81, 0xC1, 0x89, 0xCC, 0x81, 0x00, 0x01, 0x81, 0xD7, 0x81,
+    0x01, 0x01, 0x81, 0xD6, 0x81, 0x02, 0x01, 0x81, 0xD5, 0x81, 0x03, 0x01, 0x81, 0xD3, 0x82, 0x04,
+    0x01, 0x81, 0xD2, 0x82, 0x05, 0x02, 0x84, 0xCA, 0x84, 0x07, 0x03, 0x92, 0x08, 0x07, 0x8A, 0x0C,
+    // Image 4: 384 -> 180 bytes (saved 204), 4.2 runs/row (max 7)
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x07, 0x0C, 0x11, 0x11, 0x16, 0x16, 0x1B, 0x1B, 0x20,
+    0x25, 0x25, 0x2A, 0x2F, 0x2F, 0x36, 0x3D, 0x44, 0x4B, 0x52, 0x59, 0x60, 0x66, 0x6C, 0x6C, 0x6C,
+    0x6C, 0x6C, 0x6C, 0x6C, 0x6F, 0x74, 0x79, 0x79, 0x79, 0x79, 0x7E, 0x81, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x0F, 0x89, 0x05, 0x0E, 0x8B, 0x04, 0x0D, 0x81, 0xC9, 0x81, 0x03, 0x0C, 0x81, 0xCA, 0x81,
+    0x03, 0x0B, 0x81, 0xCB, 0x81, 0x03, 0x0A, 0x81, 0xCC, 0x81, 0x03, 0x09, 0x81, 0xCD, 0x81, 0x03,
+    0x08, 0x81, 0xCE, 0x81, 0x03, 0x07, 0x81, 0xCF, 0x81, 0x03, 0x06, 0x81, 0xD0, 0x81, 0x03, 0x05,
+    0x81, 0xC7, 0x80, 0xC8, 0x81, 0x03, 0x04, 0x81, 0xC7, 0x81, 0xC8, 0x81, 0x03, 0x03, 0x81, 0xC8,
+    0x81, 0xC8, 0x81, 0x03, 0x02, 0x81, 0xC8, 0x82, 0xC8, 0x81, 0x03, 0x01, 0x81, 0xC9, 0x82, 0xC8,
+    0x81, 0x03, 0x01, 0x81, 0xC8, 0x83, 0xC8, 0x81, 0x03, 0x00, 0x81, 0xC9, 0x83, 0xC8, 0x81, 0x03,
+    0x81, 0xC9, 0x84, 0xC8, 0x83, 0x01, 0x81, 0xC8, 0x85, 0xC8, 0x84, 0x00, 0x81, 0xDB, 0x81, 0x00,
+    0x8F, 0xC8, 0x84, 0x00, 0x01, 0x8E, 0xC8, 0x83, 0x01, 0x0E, 0x81, 0xC8, 0x81, 0x03, 0x0F, 0x8A,
+    0x04, 0x10, 0x88, 0x05,
+    // Image 5: 384 -> 197 bytes (saved 187), 4.4 runs/row (max 7)
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0C, 0x11,
+    0x16, 0x1B, 0x20, 0x25, 0x2C, 0x31, 0x36, 0x36, 0x3B, 0x3B, 0x40, 0x40, 0x45, 0x4A, 0x4F, 0x54,
+    0x59, 0x60, 0x65, 0x6C, 0x71, 0x71, 0x76, 0x7B, 0x80, 0x85, 0x8A, 0x8F, 0x92, 0x00, 0x00, 0x00,
+    0x1F, 0x05, 0x93, 0x05, 0x04, 0x95, 0x04, 0x03, 0x81, 0xD3, 0x81, 0x03, 0x03, 0x81, 0xC8, 0x8B,
+    0x04, 0x03, 0x81, 0xC8, 0x8A, 0x05, 0x03, 0x81, 0xC8, 0x81, 0x0E, 0x03, 0x81, 0xC8, 0x86, 0x09,
+    0x03, 0x81, 0xC8, 0x88, 0x07, 0x03, 0x81, 0xC8, 0x80, 0xC5, 0x83, 0x05, 0x02, 0x81, 0xD2, 0x82,
+    0x04, 0x02, 0x81, 0xD4, 0x81, 0x03, 0x02, 0x81, 0xD5, 0x81, 0x02, 0x02, 0x81, 0xD6, 0x81, 0x01,
+    0x02, 0x81, 0xD7, 0x81, 0x00, 0x03, 0x8A, 0xCD, 0x81, 0x00, 0x04, 0x8B, 0xCB, 0x81, 0x00, 0x0E,
+    0x82, 0xCA, 0x81, 0x00, 0x0F, 0x81, 0xCA, 0x81, 0x00, 0x03, 0x81, 0x09, 0x81, 0xCA, 0x81, 0x00,
+    0x02, 0x8D, 0xCB, 0x81, 0x00, 0x01, 0x81, 0xC1, 0x89, 0xCB, 0x81, 0x01, 0x01, 0x81, 0xD7, 0x81,
+    0x01, 0x01, 0x81, 0xD6, 0x81, 0x02, 0x01, 0x81, 0xD5, 0x81, 0x03, 0x01, 0x81, 0xD4, 0x81, 0x04,
+    0x01, 0x81, 0xD2, 0x82, 0x05, 0x01, 0x81, 0xD1, 0x82, 0x06, 0x02, 0x84, 0xCA, 0x83, 0x08, 0x03,
+    0x91, 0x09, 0x07, 0x8A, 0x0C,
+    // Image 6: 384 -> 232 bytes (saved 152), 4.8 runs/row (max 8)
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x0C, 0x11, 0x16, 0x1B, 0x20, 0x25, 0x2A, 0x2F, 0x36, 0x3B,
+    0x42, 0x49, 0x4E, 0x55, 0x5C, 0x62, 0x62, 0x66, 0x66, 0x6A, 0x6D, 0x6D, 0x72, 0x72, 0x72, 0x79,
+    0x79, 0x81, 0x88, 0x8F, 0x94, 0x99, 0x25, 0x9E, 0xA3, 0xA8, 0xAD, 0xB2, 0xB5, 0x00, 0x00, 0x00,
+    0x1F, 0x0E, 0x8A, 0x05, 0x0B, 0x8E, 0x04, 0x09, 0x84, 0xCA, 0x81, 0x03, 0x08, 0x82, 0xCE, 0x81,
+    0x02, 0x07, 0x81, 0xD0, 0x81, 0x02, 0x06, 0x81, 0xD1, 0x81, 0x02, 0x05, 0x81, 0xD2, 0x81, 0x02,
+    0x04, 0x81, 0xD3, 0x81, 0x02, 0x03, 0x81, 0xD4, 0x81, 0x02, 0x02, 0x81, 0xD5, 0x81, 0x02, 0x02,
+    0x81, 0xCC, 0x86, 0xC1, 0x81, 0x02, 0x01, 0x81, 0xCB, 0x8B, 0x03, 0x01, 0x81, 0xCA, 0x82, 0x06,
+    0x81, 0x04, 0x01, 0x81, 0xC9, 0x81, 0x00, 0x86, 0x07, 0x00, 0x81, 0xCA, 0x8B, 0x05, 0x00, 0x81,
+    0xC9, 0x83, 0xC6, 0x82, 0x04, 0x00, 0x81, 0xC9, 0x81, 0xCA, 0x81, 0x03, 0x81, 0xCA, 0x80, 0xCC,
+    0x81, 0x02, 0x81, 0xD9, 0x81, 0x01, 0x81, 0xDA, 0x81, 0x00, 0x81, 0xDB, 0x81, 0x81, 0xCB, 0x83,
+    0xCB, 0x81, 0x81, 0xCA, 0x81, 0x01, 0x81, 0xCA, 0x81, 0x00, 0x81, 0xC9, 0x81, 0x01, 0x81, 0xCA,
+    0x81, 0x00, 0x81, 0xCA, 0x83, 0xCA, 0x81, 0x00, 0x00, 0x81, 0xCB, 0x82, 0xCA, 0x81, 0x00, 0x01,
+    0x81, 0xD8, 0x81, 0x00, 0x01, 0x81, 0xD7, 0x81, 0x01, 0x02, 0x81, 0xD6, 0x81, 0x01, 0x04, 0x81,
+    0xD2, 0x81, 0x03, 0x05, 0x81, 0xD0, 0x81, 0x04, 0x06, 0x81, 0xCD, 0x82, 0x05, 0x07, 0x83, 0xC7,
+    0x84, 0x06, 0x08, 0x8D, 0x08, 0x0B, 0x87, 0x0B,
+    // Image 7: 384 -> 160 bytes (saved 224), 4.0 runs/row (max 5)
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0B, 0x10, 0x15,
+    0x1A, 0x1F, 0x24, 0x29, 0x2E, 0x33, 0x33, 0x38, 0x38, 0x3D, 0x3D, 0x42, 0x42, 0x47, 0x4C, 0x4C,
+    0x51, 0x51, 0x56, 0x5B, 0x5B, 0x5B, 0x60, 0x65, 0x65, 0x65, 0x6A, 0x6D, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x02, 0x9A, 0x01, 0x01, 0x9C, 0x00, 0x00, 0x81, 0xDA, 0x81, 0x00, 0x81, 0xD9, 0x81, 0x00,
+    0x01, 0x90, 0xC9, 0x81, 0x00, 0x02, 0x8E, 0xC9, 0x81, 0x01, 0x0E, 0x81, 0xCA, 0x81, 0x01, 0x0E,
+    0x81, 0xC9, 0x81, 0x02, 0x0D, 0x81, 0xCA, 0x81, 0x02, 0x0D, 0x81, 0xC9, 0x81, 0x03, 0x0C, 0x81,
+    0xCA, 0x81, 0x03, 0x0B, 0x81, 0xCA, 0x81, 0x04, 0x0A, 0x81, 0xCA, 0x81, 0x05, 0x09, 0x81, 0xCA,
+    0x81, 0x06, 0x08, 0x81, 0xCA, 0x81, 0x07, 0x07, 0x81, 0xCB, 0x81, 0x07, 0x07, 0x81, 0xCA, 0x81,
+    0x08, 0x06, 0x81, 0xCB, 0x81, 0x08, 0x06, 0x81, 0xCA, 0x81, 0x09, 0x05, 0x81, 0xCB, 0x81, 0x09,
+    0x05, 0x81, 0xCA, 0x81, 0x0A, 0x04, 0x81, 0xCB, 0x81, 0x0A, 0x05, 0x8D, 0x0B, 0x06, 0x8B, 0x0C,
+    // Image 8: 384 -> 185 bytes (saved 199), 5.1 runs/row (max 9)
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x0C, 0x11, 0x16, 0x1B, 0x20, 0x20, 0x25, 0x2C, 0x33, 0x33,
+    0x33, 0x3C, 0x45, 0x4C, 0x1B, 0x53, 0x58, 0x58, 0x16, 0x1B, 0x20, 0x5D, 0x2C, 0x62, 0x67, 0x67,
+    0x67, 0x67, 0x62, 0x6E, 0x5D, 0x74, 0x20, 0x1B, 0x79, 0x58, 0x7E, 0x83, 0x86, 0x00, 0x00, 0x00,
+    0x1F, 0x0B, 0x87, 0x0B, 0x08, 0x8D, 0x08, 0x06, 0x84, 0xC7, 0x84, 0x06, 0x05, 0x82, 0xCD, 0x82,
+    0x05, 0x04, 0x81, 0xD1, 0x81, 0x04, 0x03, 0x81, 0xD3, 0x81, 0x03, 0x02, 0x81, 0xD5, 0x81, 0x02,
+    0x01, 0x81, 0xD7, 0x81, 0x01, 0x00, 0x81, 0xCA, 0x82, 0xCB, 0x81, 0x00, 0x00, 0x81, 0xCA, 0x83,
+    0xCA, 0x81, 0x00, 0x00, 0x81, 0xC9, 0x81, 0x01, 0x81, 0xC9, 0x81, 0x00, 0x01, 0x81, 0xC8, 0x81,
+    0x01, 0x81, 0xC8, 0x81, 0x01, 0x01, 0x81, 0xC9, 0x83, 0xC9, 0x81, 0x01, 0x02, 0x81, 0xC9, 0x81,
+    0xC9, 0x81, 0x02, 0x03, 0x82, 0xD2, 0x81, 0x03, 0x04, 0x82, 0xCF, 0x82, 0x04, 0x00, 0x81, 0xD9,
+    0x81, 0x00, 0x81, 0xCA, 0x85, 0xCA, 0x81, 0x81, 0xC9, 0x81, 0x03, 0x81, 0xC9, 0x81, 0x81, 0xCB,
+    0x83, 0xCA, 0x81, 0x00, 0x00, 0x81, 0xD8, 0x81, 0x01, 0x03, 0x82, 0xD1, 0x82, 0x03, 0x06, 0x83,
+    0xC9, 0x83, 0x06, 0x07, 0x8F, 0x07, 0x0A, 0x89, 0x0A,
+    // Image 9: 384 -> 227 bytes (saved 157), 4.8 runs/row (max 8)
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x0C, 0x11, 0x16, 0x1B, 0x20, 0x25, 0x2A, 0x2F, 0x36, 0x3C,
+    0x3C, 0x44, 0x44, 0x44, 0x4B, 0x4B, 0x50, 0x50, 0x54, 0x54, 0x58, 0x5E, 0x64, 0x6B, 0x70, 0x77,
+    0x7C, 0x83, 0x88, 0x20, 0x8F, 0x94, 0x94, 0x99, 0x9E, 0xA3, 0xA8, 0xAD, 0xB0, 0x00, 0x00, 0x00,
+    0x1F, 0x0B, 0x87, 0x0B, 0x08, 0x8C, 0x09, 0x06, 0x84, 0xC7, 0x83, 0x07, 0x05, 0x82, 0xCC, 0x82,
+    0x06, 0x04, 0x81, 0xD0, 0x81, 0x05, 0x03, 0x81, 0xD2, 0x81, 0x04, 0x02, 0x81, 0xD4, 0x81, 0x03,
+    0x01, 0x81, 0xD6, 0x81, 0x02, 0x01, 0x81, 0xD7, 0x81, 0x01, 0x00, 0x81, 0xD8, 0x81, 0x01, 0x00,
+    0x81, 0xCA, 0x83, 0xC9, 0x81, 0x01, 0x81, 0xCB, 0x83, 0xCA, 0x81, 0x00, 0x81, 0xCA, 0x81, 0x01,
+    0x81, 0xC9, 0x81, 0x00, 0x81, 0xCA, 0x81, 0x01, 0x81, 0xCA, 0x81, 0x81, 0xCB, 0x83, 0xCB, 0x81,
+    0x00, 0x81, 0xDA, 0x81, 0x01, 0x81, 0xD9, 0x81, 0x02, 0x81, 0xCC, 0x80, 0xCA, 0x81, 0x03, 0x82,
+    0xC9, 0x81, 0xCA, 0x81, 0x04, 0x83, 0xC5, 0x83, 0xC9, 0x81, 0x00, 0x06, 0x8B, 0xC9, 0x81, 0x00,
+    0x08, 0x85, 0x00, 0x81, 0xCA, 0x81, 0x00, 0x0F, 0x81, 0xCA, 0x81, 0x00, 0x03, 0x81, 0x07, 0x82,
+    0xCA, 0x81, 0x01, 0x02, 0x8C, 0xCB, 0x81, 0x01, 0x01, 0x81, 0xC1, 0x87, 0xCC, 0x81, 0x02, 0x01,
+    0x81, 0xD5, 0x81, 0x03, 0x01, 0x81, 0xD4, 0x81, 0x04, 0x01, 0x81, 0xD2, 0x82, 0x05, 0x01, 0x81,
+    0xD1, 0x82, 0x06, 0x01, 0x81, 0xCF, 0x82, 0x08, 0x02, 0x83, 0xC9, 0x84, 0x09, 0x03, 0x8F, 0x0B,
+    0x06, 0x89, 0x0E,
+    // Image 10: 256 -> 62 bytes (saved 194), 6.4 runs/row (max 9)
+    0x00, 0x01, 0x04, 0x04, 0x04, 0x04, 0x09, 0x10, 0x10, 0x10, 0x10, 0x10, 0x09, 0x04, 0x04, 0x04,
+    0x04, 0x09, 0x10, 0x10, 0x10, 0x10, 0x10, 0x09, 0x04, 0x04, 0x04, 0x04, 0x09, 0x10, 0x19, 0x00,
+    0x1F, 0x03, 0x97, 0x03, 0x03, 0x80, 0xD5, 0x80, 0x03, 0x03, 0x80, 0xC4, 0x8B, 0xC4, 0x80, 0x03,
+    0x03, 0x80, 0xC4, 0x80, 0x09, 0x80, 0xC4, 0x80, 0x03, 0x03, 0x86, 0x09, 0x86, 0x03,
+    // Image 11: 256 -> 146 bytes (saved 110), 6.4 runs/row (max 9)
+    0x00, 0x01, 0x04, 0x04, 0x04, 0x04, 0x09, 0x10, 0x09, 0x04, 0x04, 0x04, 0x04, 0x09, 0x10, 0x10,
+    0x09, 0x04, 0x04, 0x19, 0x19, 0x1E, 0x25, 0x2E, 0x37, 0x40, 0x49, 0x52, 0x5B, 0x64, 0x6D, 0x00,
+    0x1F, 0x05, 0x94, 0x04, 0x05, 0x80, 0xD2, 0x80, 0x04, 0x05, 0x80, 0xC3, 0x89, 0xC4, 0x80, 0x04,
+    0x05, 0x80, 0xC3, 0x80, 0x07, 0x80, 0xC4, 0x80, 0x04, 0x04, 0x80, 0xD3, 0x80, 0x04, 0x04, 0x80,
+    0xC4, 0x89, 0xC4, 0x80, 0x04, 0x03, 0x80, 0xC5, 0x80, 0x07, 0x80, 0xC4, 0x80, 0x04, 0x02, 0x80,
+    0xC5, 0x80, 0x08, 0x80, 0xC4, 0x80, 0x04, 0x01, 0x80, 0xC6, 0x80, 0x03, 0x85, 0xC4, 0x80, 0x04,
+    0x00, 0x80, 0xC6, 0x80, 0x04, 0x80, 0xC9, 0x80, 0x04, 0x01, 0x80, 0xC5, 0x80, 0x05, 0x80, 0xC8,
+    0x80, 0x04, 0x01, 0x80, 0xC4, 0x80, 0x06, 0x80, 0xC8, 0x80, 0x04, 0x02, 0x80, 0xC2, 0x80, 0x07,
+    0x80, 0xC7, 0x80, 0x05, 0x03, 0x80, 0xC0, 0x80, 0x09, 0x80, 0xC5, 0x80, 0x06, 0x04, 0x80, 0x0B,
+    0x85, 0x07,
+    // Image 12: 256 -> 283 bytes (saved -27), 8.5 runs/row (max 13)
+    0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x08, 0x11, 0x1E, 0x2B, 0x38, 0x45, 0x52, 0x5F, 0x6A, 0x75,
+    0x80, 0x8D, 0x96, 0x9B, 0xA0, 0xA7, 0xAE, 0xB7, 0xC0, 0xC9, 0xD2, 0xDA, 0xE3, 0xEC, 0xF5, 0xFA,
+    0x0C, 0x85, 0x0C, 0x0C, 0x80, 0xC3, 0x80, 0x0C, 0x05, 0x82, 0x03, 0x80, 0xC3, 0x80, 0x04, 0x81,
+    0x05, 0x04, 0x80, 0xC2, 0x80, 0x02, 0x80, 0xC3, 0x80, 0x03, 0x80, 0xC1, 0x81, 0x03, 0x03, 0x80,
+    0xC4, 0x80, 0x01, 0x80, 0xC3, 0x80, 0x03, 0x80, 0xC3, 0x80, 0x02, 0x03, 0x80, 0xC4, 0x80, 0x00,
+    0x80, 0xC4, 0x80, 0x02, 0x80, 0xC5, 0x80, 0x01, 0x03, 0x80, 0xC4, 0x80, 0x00, 0x80, 0xC4, 0x80,
+    0x02, 0x80, 0xC4, 0x80, 0x02, 0x03, 0x80, 0xC4, 0x80, 0x00, 0x80, 0xC4, 0x80, 0x01, 0x80, 0xC5,
+    0x80, 0x02, 0x02, 0x80, 0xC4, 0x80, 0x01, 0x80, 0xC4, 0x80, 0x00, 0x80, 0xC5, 0x80, 0x03, 0x02,
+    0x80, 0xC4, 0x80, 0x01, 0x80, 0xC4, 0x81, 0xC5, 0x80, 0x04, 0x02, 0x80, 0xC4, 0x80, 0x01, 0x80,
+    0xC5, 0x80, 0xC5, 0x80, 0x04, 0x01, 0x80, 0xC5, 0x80, 0x01, 0x80, 0xC5, 0x82, 0xC2, 0x80, 0x05,
+    0x01, 0x83, 0xC1, 0x80, 0x01, 0x80, 0xC7, 0x80, 0x00, 0x80, 0xC0, 0x80, 0x06, 0x05, 0x81, 0x02,
+    0x80, 0xC7, 0x80, 0x01, 0x80, 0x07, 0x09, 0x80, 0xC9, 0x80, 0x09, 0x08, 0x80, 0xCA, 0x80, 0x09,
+    0x08, 0x80, 0xC4, 0x80, 0xC5, 0x80, 0x08, 0x07, 0x80, 0xC5, 0x81, 0xC5, 0x80, 0x07, 0x05, 0x81,
+    0xC5, 0x80, 0x01, 0x80, 0xC5, 0x80, 0x06, 0x04, 0x80, 0xC6, 0x80, 0x02, 0x80, 0xC6, 0x81, 0x04,
+    0x01, 0x82, 0xC6, 0x80, 0x04, 0x80, 0xC7, 0x81, 0x02, 0x00, 0x80, 0xC8, 0x80, 0x06, 0x80, 0xC8,
+    0x80, 0x01, 0x80, 0xC8, 0x80, 0x08, 0x80, 0xC8, 0x80, 0x00, 0x00, 0x80, 0xC6, 0x80, 0x0A, 0x81,
+    0xC6, 0x80, 0x00, 0x01, 0x80, 0xC3, 0x81, 0x0D, 0x80, 0xC4, 0x80, 0x01, 0x01, 0x80, 0xC2, 0x80,
+    0x10, 0x81, 0xC2, 0x80, 0x01, 0x02, 0x82, 0x13, 0x83, 0x01, 0x1F,
+    // Image 13: 256 -> 279 bytes (saved -23), 8.2 runs/row (max 13)
+    0x00, 0x03, 0x03, 0x03, 0x08, 0x0F, 0x18, 0x21, 0x2A, 0x35, 0x3E, 0x47, 0x4E, 0x55, 0x5C, 0x5C,
+    0x63, 0x6A, 0x73, 0x7C, 0x87, 0x94, 0xA1, 0xAE, 0xBB, 0xC6, 0xD3, 0xE0, 0xE9, 0xEE, 0xF3, 0xF6,
+    0x0C, 0x85, 0x0C, 0x0C, 0x80, 0xC3, 0x80, 0x0C, 0x0C, 0x80, 0xC3, 0x80, 0x05, 0x80, 0x05, 0x0C,
+    0x80, 0xC3, 0x80, 0x04, 0x80, 0xC0, 0x80, 0x04, 0x0C, 0x80, 0xC4, 0x80, 0x02, 0x80, 0xC2, 0x80,
+    0x03, 0x00, 0x8C, 0xC4, 0x80, 0x01, 0x80, 0xC4, 0x80, 0x02, 0x00, 0x80, 0xCA, 0x80, 0xC4, 0x80,
+    0x00, 0x80, 0xC6, 0x80, 0x01, 0x00, 0x80, 0xCA, 0x80, 0xC5, 0x81, 0xC5, 0x80, 0x02, 0x00, 0x80,
+    0xCA, 0x80, 0xC5, 0x80, 0xC5, 0x80, 0x03, 0x00, 0x80, 0xCA, 0x80, 0xCB, 0x80, 0x04, 0x00, 0x87,
+    0xC3, 0x80, 0xCA, 0x80, 0x05, 0x06, 0x80, 0xC4, 0x80, 0xC9, 0x80, 0x06, 0x06, 0x80, 0xC4, 0x80,
+    0xC8, 0x80, 0x07, 0x05, 0x80, 0xC4, 0x81, 0xC8, 0x80, 0x07, 0x05, 0x80, 0xC4, 0x81, 0xC3, 0x80,
+    0xC4, 0x80, 0x06, 0x04, 0x80, 0xC5, 0x81, 0xC3, 0x80, 0xC5, 0x80, 0x05, 0x03, 0x80, 0xC5, 0x80,
+    0x00, 0x80, 0xC3, 0x81, 0xC5, 0x80, 0x04, 0x02, 0x80, 0xC6, 0x80, 0x00, 0x80, 0xC3, 0x80, 0x00,
+    0x80, 0xC5, 0x80, 0x03, 0x01, 0x80, 0xC6, 0x80, 0x01, 0x80, 0xC3, 0x80, 0x00, 0x80, 0xC6, 0x82,
+    0x00, 0x00, 0x80, 0xC7, 0x80, 0x01, 0x80, 0xC3, 0x80, 0x01, 0x80, 0xC7, 0x80, 0x00, 0x00, 0x80,
+    0xC6, 0x80, 0x02, 0x80, 0xC3, 0x80, 0x02, 0x80, 0xC6, 0x80, 0x00, 0x00, 0x80, 0xC5, 0x85, 0xC3,
+    0x80, 0x03, 0x80, 0xC5, 0x80, 0x00, 0x01, 0x80, 0xC3, 0x80, 0x00, 0x80, 0xC7, 0x80, 0x04, 0x80,
+    0xC3, 0x80, 0x01, 0x02, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC7, 0x80, 0x05, 0x80, 0xC1, 0x80, 0x02,
+    0x03, 0x81, 0x02, 0x80, 0xC7, 0x80, 0x06, 0x81, 0x03, 0x09, 0x80, 0xC6, 0x80, 0x0C, 0x09, 0x80,
+    0xC5, 0x80, 0x0D, 0x0A, 0x85, 0x0E, 0x1F,
+    // Image 14: 256 -> 186 bytes (saved 70), 6.4 runs/row (max 13)
+    0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x08, 0x0C, 0x0C, 0x0C, 0x0C, 0x10, 0x14, 0x19, 0x1E, 0x23,
+    0x28, 0x2D, 0x34, 0x3D, 0x46, 0x51, 0x5D, 0x69, 0x76, 0x83, 0x90, 0x03, 0x03, 0x03, 0x00, 0x99,
+    0x0B, 0x86, 0x0C, 0x0B, 0x80, 0xC4, 0x80, 0x0C, 0x8C, 0xC4, 0x8C, 0x00, 0x80, 0xDC, 0x80, 0x00,
+    0x8A, 0xC9, 0x89, 0x00, 0x09, 0x80, 0xC9, 0x80, 0x09, 0x08, 0x80, 0xCB, 0x80, 0x08, 0x07, 0x80,
+    0xCC, 0x80, 0x08, 0x07, 0x80, 0xCD, 0x80, 0x07, 0x06, 0x80, 0xCF, 0x80, 0x06, 0x05, 0x80, 0xCA,
+    0x80, 0xC5, 0x80, 0x05, 0x04, 0x80, 0xC5, 0x80, 0xC4, 0x81, 0xC5, 0x80, 0x04, 0x03, 0x80, 0xC6,
+    0x80, 0xC4, 0x81, 0xC6, 0x81, 0x02, 0x01, 0x81, 0xC6, 0x81, 0xC4, 0x80, 0x00, 0x80, 0xC7, 0x81,
+    0x00, 0x00, 0x80, 0xC7, 0x80, 0x00, 0x80, 0xC4, 0x80, 0x01, 0x80, 0xC8, 0x80, 0x80, 0xC7, 0x80,
+    0x01, 0x80, 0xC4, 0x80, 0x02, 0x80, 0xC6, 0x80, 0x00, 0x00, 0x80, 0xC5, 0x80, 0x02, 0x80, 0xC4,
+    0x80, 0x03, 0x80, 0xC5, 0x80, 0x00, 0x01, 0x80, 0xC3, 0x80, 0x03, 0x80, 0xC4, 0x80, 0x04, 0x80,
+    0xC3, 0x80, 0x01, 0x02, 0x80, 0xC1, 0x80, 0x04, 0x80, 0xC4, 0x80, 0x05, 0x81, 0xC0, 0x80, 0x02,
+    0x03, 0x81, 0x05, 0x80, 0xC4, 0x80, 0x07, 0x80, 0x03, 0x1F,
+    // Image 15: 256 -> 184 bytes (saved 72), 6.2 runs/row (max 13)
+    0x00, 0x03, 0x08, 0x0D, 0x12, 0x17, 0x1C, 0x23, 0x2C, 0x34, 0x3A, 0x3A, 0x3F, 0x48, 0x51, 0x56,
+    0x56, 0x56, 0x56, 0x56, 0x5B, 0x64, 0x71, 0x7E, 0x89, 0x3A, 0x3A, 0x3A, 0x3A, 0x94, 0x97, 0x97,
+    0x0D, 0x83, 0x0D, 0x0C, 0x80, 0xC3, 0x80, 0x0C, 0x0B, 0x80, 0xC5, 0x80, 0x0B, 0x0A, 0x80, 0xC7,
+    0x80, 0x0A, 0x09, 0x80, 0xC9, 0x80, 0x09, 0x07, 0x81, 0xCB, 0x81, 0x07, 0x05, 0x81, 0xC7, 0x80,
+    0xC6, 0x81, 0x05, 0x03, 0x81, 0xC7, 0x81, 0x00, 0x80, 0xC7, 0x81, 0x03, 0x00, 0x82, 0xC8, 0x80,
+    0x03, 0x80, 0xC8, 0x83, 0x00, 0x80, 0xC9, 0x87, 0xCA, 0x80, 0x00, 0x80, 0xDB, 0x80, 0x00, 0x01,
+    0x80, 0xC3, 0x80, 0xCF, 0x80, 0xC3, 0x80, 0x01, 0x01, 0x80, 0xC1, 0x82, 0xCF, 0x82, 0xC1, 0x80,
+    0x01, 0x01, 0x8B, 0xC3, 0x8B, 0x01, 0x01, 0x80, 0xD9, 0x80, 0x01, 0x01, 0x85, 0xC1, 0x83, 0xC3,
+    0x83, 0xC1, 0x85, 0x01, 0x04, 0x80, 0xC4, 0x80, 0x00, 0x80, 0xC3, 0x80, 0x01, 0x80, 0xC3, 0x80,
+    0x04, 0x04, 0x80, 0xC4, 0x80, 0x00, 0x80, 0xC3, 0x80, 0x00, 0x80, 0xC4, 0x80, 0x04, 0x05, 0x80,
+    0xC4, 0x81, 0xC3, 0x80, 0x00, 0x80, 0xC3, 0x80, 0x05, 0x00, 0x85, 0xC3, 0x80, 0x00, 0x80, 0xC3,
+    0x81, 0xC4, 0x85, 0x00, 0x00, 0x9D, 0x00, 0x1F,
+    // Image 16: 256 -> 61 bytes (saved 195), 4.4 runs/row (max 5)
+    0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x12, 0x16, 0x16, 0x16, 0x16, 0x1A, 0x1C, 0x1C,
+    0x0C, 0x85, 0x0C, 0x0C, 0x80, 0xC3, 0x80, 0x0C, 0x02, 0x8A, 0xC3, 0x8A, 0x02, 0x02, 0x80, 0xD7,
+    0x80, 0x02, 0x00, 0x8C, 0xC3, 0x8D, 0x00, 0x80, 0xDC, 0x80, 0x00, 0x9E, 0x1F,
+    // Image 17: 256 -> 151 bytes (saved 105), 5.4 runs/row (max 9)
+    0x00, 0x03, 0x08, 0x0D, 0x12, 0x12, 0x17, 0x1C, 0x21, 0x27, 0x2F, 0x36, 0x3B, 0x42, 0x49, 0x50,
+    0x57, 0x57, 0x57, 0x60, 0x66, 0x66, 0x66, 0x66, 0x6A, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x73, 0x76,
+    0x07, 0x82, 0x14, 0x06, 0x80, 0xC2, 0x80, 0x13, 0x05, 0x80, 0xC4, 0x80, 0x12, 0x05, 0x80, 0xC4,
+    0x91, 0x01, 0x04, 0x80, 0xD6, 0x80, 0x01, 0x03, 0x80, 0xD7, 0x80, 0x01, 0x02, 0x80, 0xD8, 0x80,
+    0x01, 0x82, 0xC5, 0x85, 0xC4, 0x89, 0x01, 0x80, 0xC6, 0x80, 0x04, 0x80, 0xC4, 0x80, 0x0A, 0x00,
+    0x80, 0xC4, 0x87, 0xC4, 0x88, 0x02, 0x00, 0x80, 0xD9, 0x80, 0x02, 0x01, 0x80, 0xC1, 0x80, 0xD5,
+    0x80, 0x02, 0x01, 0x80, 0xC0, 0x81, 0xD5, 0x80, 0x02, 0x01, 0x81, 0x00, 0x80, 0xD5, 0x80, 0x02,
+    0x04, 0x80, 0xC4, 0x83, 0xC4, 0x88, 0x02, 0x04, 0x80, 0xC4, 0x80, 0x01, 0x80, 0xC4, 0x80, 0x0A,
+    0x85, 0xC4, 0x83, 0xC4, 0x8A, 0x00, 0x80, 0xDC, 0x80, 0x00, 0x8E, 0xC4, 0x8A, 0x00, 0x0D, 0x80,
+    0xC4, 0x80, 0x0A, 0x0D, 0x86, 0x0A, 0x1F,
+    // Image 18: 256 -> 51 bytes (saved 205), 4.8 runs/row (max 5)
+    0x00, 0x03, 0x03, 0x03, 0x03, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x03, 0x03, 0x03, 0x03, 0x00, 0x12,
+    0x0F, 0x8C, 0x02, 0x0F, 0x80, 0xCA, 0x80, 0x02, 0x0F, 0x80, 0xC3, 0x87, 0x02, 0x0F, 0x80, 0xC3,
+    0x80, 0x09, 0x1F,
+    // Image 19: 256 -> 51 bytes (saved 205), 4.8 runs/row (max 5)
+    0x00, 0x03, 0x03, 0x03, 0x03, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x08, 0x03, 0x03, 0x03, 0x03, 0x00, 0x12,
+    0x01, 0x8C, 0x10, 0x01, 0x80, 0xCA, 0x80, 0x10, 0x01, 0x87, 0xC3, 0x80, 0x10, 0x08, 0x80, 0xC3,
+    0x80, 0x10, 0x1F,
+    // Image 20: 256 -> 46 bytes (saved 210), 3.2 runs/row (max 5)
+    0x00, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x00, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x00, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x00, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0B, 0x87, 0x0B, 0x0A, 0x80, 0xC7, 0x80, 0x0A, 0x09, 0x81, 0xC7, 0x81, 0x09, 0x1F,
 };
@@ -24,8 +24,12 @@
 
 #include <arduino.h>
 #include <EEPROM.h>
+#include <avr/wdt.h>
 #include "RX8900Controller.h"
 #include "ACePController.h"
+#include "StateController.h"
+#include "ScheduleController.h"
+#include "Logger.h"
 #include "testpatterndata.h"
 
 #define VERSION "0.2.0"
@@ -37,10 +41,17 @@ static void commandNow(char *pArg, uint8_t argLen);
 static void commandDate(char *pArg, uint8_t argLen);
 static void commandTime(char *pArg, uint8_t argLen);
 static void commandAlarm(char *pArg, uint8_t argLen);
+static void commandNext(char *pArg, uint8_t argLen);
+static void commandClock(char *pArg, uint8_t argLen);
+static void commandLayout(char *pArg, uint8_t argLen);
+static void commandColors(char *pArg, uint8_t argLen);
+static void commandShuffle(char *pArg, uint8_t argLen);
 static void commandClear(char *pArg, uint8_t argLen);
 static void commandIndex(char *pArg, uint8_t argLen);
 static void commandLoad(char *pArg, uint8_t argLen);
 static void commandExamine(char *pArg, uint8_t argLen);
+static void commandBench(char *pArg, uint8_t argLen);
+static void commandFault(char *pArg, uint8_t argLen);
 static void commandHelp(char *pArg, uint8_t argLen);
 static void commandVersion(char *pArg, uint8_t argLen);
 static void commandQuit(char *pArg, uint8_t argLen);
@@ -50,7 +61,8 @@ static void printCurrentDate(void);
 static void printCurrentTime(void);
 static void printAlarmTime(void);
 static void printTime(uint8_t hour, uint8_t minute, uint8_t second);
-static void printIndexAndPath(uint8_t index, const char *path);
+static void printIndexAndPath(uint16_t index, uint16_t fileIndex, const char *path);
+static void printMicros(const __FlashStringHelper *pLabel, uint32_t value);
 static bool extractNumber(char *p, uint8_t digits, uint16_t &value);
 
 typedef struct {
@@ -63,10 +75,17 @@ PROGMEM static const char usageNow[]     = "Show current date and time.";
 PROGMEM static const char usageDate[]    = "Set date by 8 digits (yyyymmdd).";
 PROGMEM static const char usageTime[]    = "Set time by 6 digits (HHMMSS).";
 PROGMEM static const char usageAlarm[]   = "Set alarm time by 4 digits (HHMM).";
+PROGMEM static const char usageNext[]    = "Show next scheduled event.";
+PROGMEM static const char usageClock[]   = "Set clock interval (0-255 min).";
+PROGMEM static const char usageLayout[]  = "Set number of images (1, 2 or 4).";
+PROGMEM static const char usageColors[]  = "Remap colors by 7 digits (0-6).";
+PROGMEM static const char usageShuffle[] = "Set shuffle mode (0 or 1).";
 PROGMEM static const char usageClear[]   = "Clear display with color (0-6).";
-PROGMEM static const char usageIndex[]   = "Set image index number (0-255).";
-PROGMEM static const char usageLoad[]    = "Load image data (0-255 or current).";
+PROGMEM static const char usageIndex[]   = "Set image index number (0-65535).";
+PROGMEM static const char usageLoad[]    = "Load image data (0-65535 or current).";
 PROGMEM static const char usageExamine[] = "Examine function (0-3).";
+PROGMEM static const char usageBench[]   = "Measure SPI, SD, render and I2C (us).";
+PROGMEM static const char usageFault[]   = "Show fault log (0 to clear).";
 PROGMEM static const char usageHelp[]    = "Show command help.";
 PROGMEM static const char usageVersion[] = "Show version information.";
 PROGMEM static const char usageQuit[]    = "Quit shell.";
@@ -76,18 +95,44 @@ PROGMEM static const Command_T commandTable[] = {
     { "DATE",    commandDate,    usageDate    },
     { "TIME",    commandTime,    usageTime    },
     { "ALARM",   commandAlarm,   usageAlarm   },
+    { "NEXT",    commandNext,    usageNext    },
+    { "CLOCK",   commandClock,   usageClock   },
+    { "LAYOUT",  commandLayout,  usageLayout  },
+    { "COLORS",  commandColors,  usageColors  },
+    { "SHUFFLE", commandShuffle, usageShuffle },
     { "CLEAR",   commandClear,   usageClear   },
     { "INDEX",   commandIndex,   usageIndex   },
     { "LOAD",    commandLoad,    usageLoad    },
     { "EXAMINE", commandExamine, usageExamine },
+    { "BENCH",   commandBench,   usageBench   },
+    { "FAULT",   commandFault,   usageFault   },
     { "HELP",    commandHelp,    usageHelp    },
     { "VERSION", commandVersion, usageVersion },
     { "QUIT",    commandQuit,    usageQuit    },
 };
 
-extern RX8900Controller rtc;
-extern ACePController   acep;
-extern bool             isShellEnabled;
+PROGMEM static const char faultNames[FAULT_PHASE_MAX][8] = {
+    "NONE", "RTC", "PANEL", "SCAN", "DISPLAY",
+};
+
+PROGMEM static const char weekDayNames[7][4] = {
+    "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat",
+};
+
+PROGMEM static const char actionNames[][8] = {
+    "NONE", "RETRY", "PHOTO", "REDRAW", "CLEAN",
+};
+
+bool scheduleNextAlarm(void);
+bool scheduleClock(void);
+ACEP_LAYOUT getLayout(void);
+uint16_t mapImageIndex(uint16_t index);
+
+extern RX8900Controller           rtc;
+extern ACePController<ACEP_PANEL> acep;
+extern StateController            state;
+extern ScheduleController         schedule;
+extern bool                       isShellEnabled;
 
 static char     inputBuf[INPUT_BUF_SIZE];
 static uint8_t  inputPos = 0;
@@ -133,7 +178,10 @@ void handleSerialInput(char data)
                     while (commandLen + 1 + argLen < inputPos && pArg[argLen] != ' ') {
                         argLen++;
                     }
+                    // The commands access the panel, SD and RTC as well as the schedule does
+                    wdt_enable(WDTO_8S);
                     ((void (*)(char *, uint8_t))pgm_read_ptr(&commandTable[i].func))(pArg, argLen);
+                    wdt_disable();
                     isMatched = true;
                     break;
                 }
@@ -149,6 +197,13 @@ void handleSerialInput(char data)
     }
 }
 
+void handleShellTimeout(void)
+{
+    Serial.println();
+    Serial.println(F("Timed out."));
+    commandQuit(NULL, 0);
+}
+
 /*---------------------------------------------------------------------------*/
 
 static void commandNow(char *pArg, uint8_t argLen)
@@ -194,7 +249,106 @@ static void commandAlarm(char *pArg, uint8_t argLen)
     }
     uint16_t hour, minute;
     bool isOK = argLen == 4 && extractNumber(pArg, 2, hour) && extractNumber(pArg + 2, 2, minute) &&
-            rtc.setAlarm(hour, minute);
+            hour < 24 && minute < 60;
+    if (isOK) {
+        schedule.setAlarmTime(hour, minute);
+        state.setAlarm(hour, minute);
+        isOK = state.save() && scheduleNextAlarm();
+    }
+    printResult(isOK);
+}
+
+static void commandNext(char *pArg, uint8_t argLen)
+{
+    uint8_t weekDay, hour, minute, second;
+    if (!rtc.getWeekDay(weekDay) || !rtc.getTime(hour, minute, second)) {
+        printResult(false);
+        return;
+    }
+    uint8_t nextWeekDay, nextHour, nextMinute;
+    SCHEDULE_ACTION action = schedule.getNextEntry(weekDay, hour, minute, nextWeekDay, nextHour, nextMinute);
+    Serial.print((const __FlashStringHelper *)weekDayNames[nextWeekDay]);
+    Serial.print(' ');
+    printTime(nextHour, nextMinute, 0);
+    Serial.print(' ');
+    Serial.println((const __FlashStringHelper *)actionNames[action]);
+}
+
+static void commandClock(char *pArg, uint8_t argLen)
+{
+    uint16_t interval;
+    if (argLen == 0) {
+        Serial.println(state.getClockInterval());
+        return;
+    }
+    bool isOK = extractNumber(pArg, argLen, interval) && interval <= UINT8_MAX &&
+            (ACEP_PANEL::HAS_PARTIAL_WINDOW || interval == 0);
+    if (isOK) {
+        state.setClockInterval(interval);
+        isOK = state.save() && scheduleClock();
+    }
+    printResult(isOK);
+}
+
+static void commandLayout(char *pArg, uint8_t argLen)
+{
+    uint16_t layout;
+    if (argLen == 0) {
+        Serial.println(getLayout());
+        return;
+    }
+    bool isOK = extractNumber(pArg, argLen, layout) &&
+            (layout == LAYOUT_FULL || layout == LAYOUT_HALVES || layout == LAYOUT_QUARTERS);
+    if (isOK) {
+        state.setLayout(layout);
+        state.setImageIndex(0);
+        rtc.setImageIndex(0);
+        isOK = state.save() && scheduleClock();
+    }
+    printResult(isOK);
+}
+
+static void commandColors(char *pArg, uint8_t argLen)
+{
+    uint8_t colorMap[ACEP_COLORS];
+    if (argLen == 0) {
+        for (uint8_t i = 0; i < ACEP_COLORS; i++) {
+            colorMap[i] = i;
+        }
+        state.getColorMap(colorMap);
+        for (uint8_t i = 0; i < ACEP_COLORS; i++) {
+            Serial.print(colorMap[i]);
+        }
+        Serial.println();
+        return;
+    }
+    bool isOK = (argLen == ACEP_COLORS);
+    for (uint8_t i = 0; i < ACEP_COLORS && isOK; i++) {
+        colorMap[i] = pArg[i] - '0';
+        isOK = pArg[i] >= '0' && colorMap[i] < ACEP_COLORS;
+    }
+    if (isOK) {
+        state.setColorMap(colorMap);
+        acep.setColorMap(colorMap);
+        isOK = state.save();
+    }
+    printResult(isOK);
+}
+
+static void commandShuffle(char *pArg, uint8_t argLen)
+{
+    uint16_t seed, mode;
+    if (argLen == 0) {
+        Serial.println(state.getShuffle(seed) ? 1 : 0);
+        return;
+    }
+    bool isOK = extractNumber(pArg, argLen, mode) && mode <= 1;
+    if (isOK) {
+        state.setShuffle(mode == 1, micros()); // the order depends on when it is enabled
+        state.setImageIndex(0);
+        rtc.setImageIndex(0);
+        isOK = state.save();
+    }
     printResult(isOK);
 }
 
@@ -212,17 +366,20 @@ static void commandIndex(char *pArg, uint8_t argLen)
 {
     uint16_t index = 0;
     if (argLen == 0) {
-        index = rtc.getImageIndex();
+        index = state.getImageIndex();
+        uint16_t fileIndex = mapImageIndex(index);
         char path[PATH_LEN_MAX];
-        if (acep.specifyImagePathOfSD(index, path)) {
-            index = 0;
+        if (acep.specifyImagePathOfSD(fileIndex, path)) {
+            index = fileIndex = 0;
         }
-        printIndexAndPath(index, path);
+        printIndexAndPath(index, fileIndex, path);
         return;
     }
-    bool isOK = extractNumber(pArg, argLen, index) && index <= UINT8_MAX;
+    bool isOK = extractNumber(pArg, argLen, index);
     if (isOK) {
+        state.setImageIndex(index);
         rtc.setImageIndex(index);
+        isOK = state.save();
     }
     printResult(isOK);
 }
@@ -230,14 +387,15 @@ static void commandIndex(char *pArg, uint8_t argLen)
 static void commandLoad(char *pArg, uint8_t argLen)
 {
     uint16_t index;
-    if (argLen == 0 || !extractNumber(pArg, argLen, index) || index > UINT8_MAX) {
-        index = rtc.getImageIndex();
+    if (argLen == 0 || !extractNumber(pArg, argLen, index)) {
+        index = state.getImageIndex();
     }
+    uint16_t fileIndex = mapImageIndex(index);
     char path[PATH_LEN_MAX];
-    if (acep.specifyImagePathOfSD(index, path)) {
-        index = 0;
+    if (acep.specifyImagePathOfSD(fileIndex, path)) {
+        index = fileIndex = 0;
     }
-    printIndexAndPath(index, path);
+    printIndexAndPath(index, fileIndex, path);
     bool isOK = acep.displayACePDataFromSD(path);
     printResult(isOK);
 }
@@ -259,7 +417,7 @@ static void commandExamine(char *pArg, uint8_t argLen)
             }
             acep.clearDisplay();
             char path[PATH_LEN_MAX];
-            acep.specifyImagePathOfSD(rtc.getImageIndex(), path);
+            acep.specifyImagePathOfSD(mapImageIndex(state.getImageIndex()), path);
             isOK = acep.displayACePDataFromSD(path, true);
             break;
         case 1:
@@ -275,6 +433,44 @@ static void commandExamine(char *pArg, uint8_t argLen)
     printResult(isOK);
 }
 
+static void commandBench(char *pArg, uint8_t argLen)
+{
+    ACePBenchmark_T result;
+    bool isOK = acep.benchmark(result);
+    if (isOK) {
+        printMicros(F("SPI row"), result.spiRow);
+        printMicros(F("SD raw block"), result.sdRawBlock);
+        printMicros(F("SD file row"), result.sdFileRow);
+        printMicros(F("Dir scan"), result.dirScan);
+        printMicros(F("Overlay row"), result.overlapRow);
+        uint8_t hour, minute, second;
+        uint32_t start = micros();
+        rtc.getTime(hour, minute, second);
+        printMicros(F("I2C RX8900"), micros() - start);
+    }
+    printResult(isOK);
+}
+
+static void commandFault(char *pArg, uint8_t argLen)
+{
+    if (argLen > 0) {
+        state.clearFaults();
+        printResult(state.save());
+        return;
+    }
+    for (uint8_t phase = FAULT_RTC; phase < FAULT_PHASE_MAX; phase++) {
+        Serial.print((const __FlashStringHelper *)faultNames[phase]);
+        Serial.print(F(": "));
+        Serial.println(state.getFaultCount((FAULT_PHASE)phase));
+    }
+    Serial.print(F("Last: "));
+    Serial.println((const __FlashStringHelper *)faultNames[state.getLastFault()]);
+
+    // The log messages lost while the buffer was full since the boot
+    Serial.print(F("Log dropped: "));
+    Serial.println(logger.getDroppedCount());
+}
+
 static void commandHelp(char *pArg, uint8_t argLen)
 {
     for (uint8_t i = 0; i < sizeof(commandTable) / sizeof(commandTable[0]); i++) {
@@ -298,6 +494,7 @@ static void commandVersion(char *pArg, uint8_t argLen)
 static void commandQuit(char *pArg, uint8_t argLen)
 {
     isShellEnabled = false;
+    logger.end();
     Serial.println(F("Good bye!"));
     Serial.end();
 }
@@ -333,46 +530,51 @@ static void printCurrentTime(void)
 static void printAlarmTime(void)
 {
     uint8_t hour, minute;
-    if (rtc.getAlarm(hour, minute)) {
-        printTime(hour, minute, 0);
-    }
+    schedule.getAlarmTime(hour, minute);
+    printTime(hour, minute, 0);
 }
 
 static void printTime(uint8_t hour, uint8_t minute, uint8_t second)
 {
-    if (hour < 10) {
-        Serial.print('0');
-    }
-    Serial.print(hour);
-    Serial.print(':');
-    if (minute < 10) {
-        Serial.print('0');
-    }
-    Serial.print(minute);
-    Serial.print(':');
-    if (second < 10) {
-        Serial.print('0');
-    }
-    Serial.print(second);
+    char text[9];
+    snprintf_P(text, sizeof(text), PSTR("%02d:%02d:%02d"), hour, minute, second);
+    Serial.print(text);
 }
 
-static void printIndexAndPath(uint8_t index, const char *path)
+static void printIndexAndPath(uint16_t index, uint16_t fileIndex, const char *path)
 {
+    // The index of the file is shown as well if it differs by the shuffled order
     Serial.print('[');
     Serial.print(index);
+    if (fileIndex != index) {
+        Serial.print(F(" -> "));
+        Serial.print(fileIndex);
+    }
     Serial.print(F("] path: "));
     Serial.println(path);
 }
 
+static void printMicros(const __FlashStringHelper *pLabel, uint32_t value)
+{
+    Serial.print(pLabel);
+    Serial.print(F(": "));
+    Serial.print(value);
+    Serial.println(F(" us"));
+}
+
 static bool extractNumber(char *p, uint8_t digits, uint16_t &value)
 {
-    value = 0;
+    uint32_t number = 0;
     while (digits--) {
         if (*p < '0' || *p > '9') {
             return false;
         }
-        value = value * 10 + (*p - '0');
+        number = number * 10 + (*p - '0');
+        if (number > UINT16_MAX) {
+            return false;
+        }
         p++;
     }
+    value = number;
     return true;
 }
@@ -0,0 +1,266 @@
+/**
+ * ArduinoACePCalendar : "Quantizer.cpp"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <mutex>
+#include "Quantizer.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAS_X86_KERNELS
+#endif
+
+// Errors are kept in RGB as 4 floats per pixel (the last one is unused) so that a pixel
+// fits in one SSE register. The nearest color is searched among 8 lanes, the 8th being
+// a dummy color far away. Every kernel does the same float operations in the same order,
+// so the outputs are identical to the scalar reference. The error of a pixel depends on
+// the previous one, so the pixels are done one by one and wider vectors than a pixel
+// don't help. With L*a*b*, most of the time goes to the conversion of each pixel.
+
+#define UNREACHABLE     1.0e6f
+#define TABLE_SIZE      1024    // steps of the tables for Lab conversion
+
+static const float paletteColors[7][3] = {  // same as master_pal of image2acp.py
+    { 0, 0, 0 }, { 255, 255, 255 }, { 0, 128, 0 }, { 0, 0, 255 },
+    { 255, 0, 0 }, { 255, 255, 0 }, { 255, 170, 0 },
+};
+
+static const float weightRight = 7.0f / 16.0f;
+static const float weightBelowBehind = 3.0f / 16.0f;
+static const float weightBelow = 5.0f / 16.0f;
+static const float weightBelowAhead = 1.0f / 16.0f;
+
+// sRGB to linear over 0-255, and the cube root of CIE over 0-1, both interpolated
+static float linearTable[TABLE_SIZE + 1];
+static float cubeRootTable[TABLE_SIZE + 1];
+
+static void initializeTables(void)
+{
+    for (int i = 0; i <= TABLE_SIZE; i++) {
+        float value = (float)i / TABLE_SIZE;
+        cubeRootTable[i] = (value > 0.008856f) ? cbrtf(value) : 7.787f * value + 16.0f / 116.0f;
+        linearTable[i] = (value <= 0.04045f) ? value / 12.92f : powf((value + 0.055f) / 1.055f, 2.4f);
+    }
+}
+
+static inline float lookUpTable(const float *pTable, float value)
+{
+    // The value is 0-1, which can be a little over 1 for the cube root
+    float position = value * TABLE_SIZE;
+    int i = (int)position;
+    if (i >= TABLE_SIZE) {
+        return pTable[TABLE_SIZE];
+    }
+    return pTable[i] + (pTable[i + 1] - pTable[i]) * (position - i);
+}
+
+static inline float clampColor(float value)
+{
+    return (value < 0.0f) ? 0.0f : (value > 255.0f) ? 255.0f : value;
+}
+
+static inline void putColor(uint8_t *pOut, uint32_t x, uint8_t color)
+{
+    if (x & 1) {
+        pOut[x / 2] = (pOut[x / 2] & 0xF0) | color;
+    } else {
+        pOut[x / 2] = (pOut[x / 2] & 0x0F) | color << 4;
+    }
+}
+
+static inline void convertColor(QUANTIZER_METRIC metric, const float *pColor, float *pTarget)
+{
+    if (metric == METRIC_RGB) {
+        memcpy(pTarget, pColor, sizeof(float) * 3);
+        return;
+    }
+
+    // CIE L*a*b* from sRGB (D65), scaled to be comparable with 0-255 RGB
+    float linear[3];
+    for (int i = 0; i < 3; i++) {
+        linear[i] = lookUpTable(linearTable, pColor[i] / 255.0f);
+    }
+    float xyz[3] = {
+        (0.4124f * linear[0] + 0.3576f * linear[1] + 0.1805f * linear[2]) / 0.95047f,
+        0.2126f * linear[0] + 0.7152f * linear[1] + 0.0722f * linear[2],
+        (0.0193f * linear[0] + 0.1192f * linear[1] + 0.9505f * linear[2]) / 1.08883f,
+    };
+    for (int i = 0; i < 3; i++) {
+        xyz[i] = lookUpTable(cubeRootTable, xyz[i]);
+    }
+    pTarget[0] = (116.0f * xyz[1] - 16.0f) * 2.55f;
+    pTarget[1] = 500.0f * (xyz[0] - xyz[1]) * 2.55f;
+    pTarget[2] = 200.0f * (xyz[1] - xyz[2]) * 2.55f;
+}
+
+/*---------------------------------------------------------------------------*/
+
+Quantizer::Quantizer(uint32_t width, QUANTIZER_METRIC metric, bool isSerpentine, QUANTIZER_KERNEL kernel)
+    : width(width), metric(metric), isSerpentine(isSerpentine), kernel(kernel)
+{
+    static std::once_flag tablesFlag;
+    std::call_once(tablesFlag, initializeTables);
+    for (int i = 0; i < 8; i++) {
+        float target[3] = { UNREACHABLE, UNREACHABLE, UNREACHABLE };
+        if (i < 7) {
+            convertColor(metric, paletteColors[i], target);
+        }
+        for (int j = 0; j < 3; j++) {
+            targetColors[j][i] = target[j];
+        }
+    }
+    for (int i = 0; i < 2; i++) {
+        errors[i].assign((width + 2) * 4, 0.0f);
+    }
+}
+
+QUANTIZER_KERNEL Quantizer::getBestKernel(void)
+{
+#ifdef HAS_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2")) {
+        return KERNEL_SSE2;
+    }
+#endif
+    return KERNEL_SCALAR;
+}
+
+const char *Quantizer::getKernelName(QUANTIZER_KERNEL kernel)
+{
+    static const char *names[] = { "scalar", "SSE2" };
+    return names[kernel];
+}
+
+void Quantizer::quantizeRow(const uint8_t *pRgb, uint8_t *pOut, uint32_t y)
+{
+    // The error of this row is in errors[0] and that of the next row goes to errors[1]
+    bool isReverse = isSerpentine && (y & 1);
+    errors[0].swap(errors[1]);
+    errors[1].assign(errors[1].size(), 0.0f);
+    switch (kernel) {
+#ifdef HAS_X86_KERNELS
+    case KERNEL_SSE2:
+        quantizeRowSse2(pRgb, pOut, isReverse);
+        break;
+#endif
+    default:
+        quantizeRowScalar(pRgb, pOut, isReverse);
+        break;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+
+void Quantizer::quantizeRowScalar(const uint8_t *pRgb, uint8_t *pOut, bool isReverse)
+{
+    int step = isReverse ? -1 : 1;
+    for (uint32_t i = 0; i < width; i++) {
+        uint32_t x = isReverse ? width - 1 - i : i;
+        float *pError = &errors[0][(x + 1) * 4];
+        float *pBelow = &errors[1][(x + 1) * 4];
+        float color[3], target[3];
+        for (int j = 0; j < 3; j++) {
+            color[j] = clampColor(pRgb[x * 3 + j] + pError[j]);
+        }
+        convertColor(metric, color, target);
+        uint8_t best = 0;
+        float minDistance = UNREACHABLE * UNREACHABLE;
+        for (int k = 0; k < 8; k++) {
+            float d0 = target[0] - targetColors[0][k];
+            float d1 = target[1] - targetColors[1][k];
+            float d2 = target[2] - targetColors[2][k];
+            float distance = d0 * d0 + d1 * d1 + d2 * d2;
+            if (distance < minDistance) {
+                minDistance = distance;
+                best = k;
+            }
+        }
+        putColor(pOut, x, best);
+        for (int j = 0; j < 3; j++) {
+            float error = color[j] - paletteColors[best][j];
+            pError[step * 4 + j] += error * weightRight;
+            pBelow[-step * 4 + j] += error * weightBelowBehind;
+            pBelow[j] += error * weightBelow;
+            pBelow[step * 4 + j] += error * weightBelowAhead;
+        }
+    }
+}
+
+#ifdef HAS_X86_KERNELS
+
+static inline __m128 loadPixel(const uint8_t *p)
+{
+    return _mm_setr_ps(p[0], p[1], p[2], 0.0f);
+}
+
+static inline __m128 paletteVector(uint8_t color)
+{
+    return _mm_setr_ps(paletteColors[color][0], paletteColors[color][1], paletteColors[color][2], 0.0f);
+}
+
+static inline void diffuseError(float *pError, float *pBelow, int step, __m128 error)
+{
+    float *pRight = pError + step * 4;
+    _mm_storeu_ps(pRight, _mm_add_ps(_mm_loadu_ps(pRight), _mm_mul_ps(error, _mm_set1_ps(weightRight))));
+    float *pBehind = pBelow - step * 4;
+    _mm_storeu_ps(pBehind, _mm_add_ps(_mm_loadu_ps(pBehind), _mm_mul_ps(error, _mm_set1_ps(weightBelowBehind))));
+    _mm_storeu_ps(pBelow, _mm_add_ps(_mm_loadu_ps(pBelow), _mm_mul_ps(error, _mm_set1_ps(weightBelow))));
+    float *pAhead = pBelow + step * 4;
+    _mm_storeu_ps(pAhead, _mm_add_ps(_mm_loadu_ps(pAhead), _mm_mul_ps(error, _mm_set1_ps(weightBelowAhead))));
+}
+
+void Quantizer::quantizeRowSse2(const uint8_t *pRgb, uint8_t *pOut, bool isReverse)
+{
+    int step = isReverse ? -1 : 1;
+    const __m128 zero = _mm_setzero_ps(), max = _mm_set1_ps(255.0f);
+    for (uint32_t i = 0; i < width; i++) {
+        uint32_t x = isReverse ? width - 1 - i : i;
+        float *pError = &errors[0][(x + 1) * 4];
+        float *pBelow = &errors[1][(x + 1) * 4];
+        __m128 color = _mm_min_ps(_mm_max_ps(_mm_add_ps(loadPixel(&pRgb[x * 3]), _mm_loadu_ps(pError)), zero), max);
+        float colors[4], target[3];
+        _mm_storeu_ps(colors, color);
+        convertColor(metric, colors, target);
+
+        // Distances to the 8 lanes in two halves
+        __m128 distances[2];
+        for (int h = 0; h < 2; h++) {
+            __m128 d0 = _mm_sub_ps(_mm_set1_ps(target[0]), _mm_loadu_ps(&targetColors[0][h * 4]));
+            __m128 d1 = _mm_sub_ps(_mm_set1_ps(target[1]), _mm_loadu_ps(&targetColors[1][h * 4]));
+            __m128 d2 = _mm_sub_ps(_mm_set1_ps(target[2]), _mm_loadu_ps(&targetColors[2][h * 4]));
+            distances[h] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(d0, d0), _mm_mul_ps(d1, d1)), _mm_mul_ps(d2, d2));
+        }
+        __m128 minimum = _mm_min_ps(distances[0], distances[1]);
+        minimum = _mm_min_ps(minimum, _mm_shuffle_ps(minimum, minimum, _MM_SHUFFLE(1, 0, 3, 2)));
+        minimum = _mm_min_ps(minimum, _mm_shuffle_ps(minimum, minimum, _MM_SHUFFLE(2, 3, 0, 1)));
+        int mask = _mm_movemask_ps(_mm_cmpeq_ps(distances[0], minimum)) |
+                _mm_movemask_ps(_mm_cmpeq_ps(distances[1], minimum)) << 4;
+        uint8_t best = __builtin_ctz(mask);
+
+        putColor(pOut, x, best);
+        diffuseError(pError, pBelow, step, _mm_sub_ps(color, paletteVector(best)));
+    }
+}
+
+#endif // HAS_X86_KERNELS
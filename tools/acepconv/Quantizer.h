@@ -0,0 +1,65 @@
+/**
+ * ArduinoACePCalendar : "Quantizer.h"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+// Floyd-Steinberg error diffusion onto the 7 panel colors
+
+enum QUANTIZER_METRIC
+{
+    METRIC_RGB = 0,
+    METRIC_LAB,
+};
+
+enum QUANTIZER_KERNEL
+{
+    KERNEL_SCALAR = 0,  // reference
+    KERNEL_SSE2,
+};
+
+class Quantizer
+{
+public:
+    Quantizer(uint32_t width, QUANTIZER_METRIC metric, bool isSerpentine, QUANTIZER_KERNEL kernel);
+    ~Quantizer()
+    {}
+
+    static QUANTIZER_KERNEL getBestKernel(void);
+    static const char *getKernelName(QUANTIZER_KERNEL kernel);
+    void quantizeRow(const uint8_t *pRgb, uint8_t *pOut, uint32_t y);
+
+private:
+    void quantizeRowScalar(const uint8_t *pRgb, uint8_t *pOut, bool isReverse);
+    void quantizeRowSse2(const uint8_t *pRgb, uint8_t *pOut, bool isReverse);
+
+    uint32_t width;
+    QUANTIZER_METRIC metric;
+    bool isSerpentine;
+    QUANTIZER_KERNEL kernel;
+    float targetColors[3][8];       // per channel, in the space of the metric
+    std::vector<float> errors[2];   // 4 floats / pixel with a margin on both ends
+};
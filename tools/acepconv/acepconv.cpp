@@ -0,0 +1,456 @@
+/**
+ * ArduinoACePCalendar : "acepconv.cpp"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Converts QOI images into the formats read by the firmware, using the same decoder
+// and dithering as QoiDecoder on the device, or error diffusion by Quantizer. Files
+// are converted in parallel and written through memory-mapped outputs, and they can
+// be displayed by ACePController on the emulated panel to verify the round trip.
+//
+// Build:
+//   g++ -std=c++11 -O2 -pthread -I../acepemu -o acepconv acepconv.cpp Quantizer.cpp
+//       ../acepemu/HostArduino.cpp ../acepemu/UC8159Emulator.cpp ../../ACePController.cpp
+//       ../../QoiDecoder.cpp
+
+#include <stdio.h>
+#include <errno.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <SD.h>
+#include <util/crc16.h>
+#include "HostArduino.h"
+#include "../../QoiDecoder.h"
+#include "Quantizer.h"
+
+typedef ACePController<ACEP_PANEL> Controller;
+
+enum OUTPUT_FORMAT
+{
+    FORMAT_RAW = 0,
+    FORMAT_HEADER,
+    FORMAT_TILED,
+    FORMAT_HALF,
+};
+
+static OUTPUT_FORMAT outputFormat = FORMAT_RAW;
+static bool isVersioned = false, isBandTable = false;
+static const char *pOutputDir = ".";
+static bool isErrorDiffusion = false, isSerpentine = false;
+static QUANTIZER_METRIC metric = METRIC_RGB;
+static QUANTIZER_KERNEL kernel = Quantizer::getBestKernel();
+static bool isVerify = false;
+static std::vector<std::string> inputPaths;
+static std::mutex printMutex, verifyMutex;
+static Controller acep;
+
+static void printError(const std::string &path, const char *pMessage)
+{
+    std::lock_guard<std::mutex> lock(printMutex);
+    fprintf(stderr, "%s: %s\n", path.c_str(), pMessage);
+}
+
+static bool isQoiPath(const char *path)
+{
+    size_t len = strlen(path);
+    return len > 4 && strcasecmp(path + len - 4, ".qoi") == 0;
+}
+
+static void addInputPath(const char *path)
+{
+    char absPath[PATH_MAX];
+    if (!realpath(path, absPath)) {
+        printError(path, "not found");
+        return;
+    }
+    DIR *pDir = opendir(absPath);
+    if (!pDir) {
+        inputPaths.push_back(absPath);
+        return;
+    }
+    struct dirent *pEntry;
+    while ((pEntry = readdir(pDir)) != NULL) {
+        if (isQoiPath(pEntry->d_name)) {
+            inputPaths.push_back(std::string(absPath) + "/" + pEntry->d_name);
+        }
+    }
+    closedir(pDir);
+}
+
+static uint32_t calculateCrc32(const uint8_t *p, uint32_t len)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    while (len-- > 0) {
+        crc ^= *p++;
+        for (int i = 0; i < 8; i++) {
+            crc = crc >> 1 ^ ((crc & 1) ? 0xEDB88320 : 0);
+        }
+    }
+    return ~crc;
+}
+
+static bool hasBandTable(uint32_t width, uint32_t height)
+{
+    // The firmware takes the table only if the rows are displayed as they are
+    return isBandTable && (outputFormat == FORMAT_HALF ||
+            (outputFormat != FORMAT_TILED && width == Controller::WIDTH && height == Controller::HEIGHT));
+}
+
+static void writeBandTable(uint8_t *p, const uint8_t *pData)
+{
+    // Each row of a half resolution image is doubled in both directions as displayed
+    bool isHalf = (outputFormat == FORMAT_HALF);
+    for (uint32_t i = 0; i < Controller::BAND_COUNT; i++) {
+        uint16_t crc = 0xFFFF;
+        for (uint32_t y = i * ACEP_BAND_H; y < (i + 1) * ACEP_BAND_H && y < Controller::HEIGHT; y++) {
+            const uint8_t *pRow = pData + (isHalf ? y / 2 * Controller::ROW_BYTES / 2 : y * Controller::ROW_BYTES);
+            for (uint32_t x = 0; x < Controller::ROW_BYTES; x++) {
+                uint8_t pair = pRow[isHalf ? x / 2 : x];
+                if (isHalf) {
+                    pair = (x & 1) ? (pair & 0x0F) | pair << 4 : (pair & 0xF0) | pair >> 4;
+                }
+                crc = _crc16_update(crc, pair);
+            }
+        }
+        p[i * 2] = crc & 0xFF;
+        p[i * 2 + 1] = crc >> 8;
+    }
+}
+
+static void writeHeader(uint8_t *p, uint32_t width, uint32_t height, uint32_t headerSize, uint32_t dataSize)
+{
+    // The versioned header has the CRC of the payload, which is already written after it
+    static const char *const pMagics[] = { NULL, ACEP_HEADER_MAGIC, ACEP_TILED_MAGIC, ACEP_HALF_MAGIC };
+    static const ACEP_FORMAT formats[] = { ACEP_FORMAT_RAW, ACEP_FORMAT_RAW, ACEP_FORMAT_TILED, ACEP_FORMAT_HALF };
+    ACePVersionHeader_T header;
+    memset(&header, 0, sizeof(header));
+    header.common.width = width;
+    header.common.height = height;
+    if (!isVersioned) {
+        if (outputFormat != FORMAT_RAW) {
+            memcpy(header.common.magic, pMagics[outputFormat], sizeof(header.common.magic));
+            memcpy(p, &header.common, sizeof(header.common));
+        }
+        return;
+    }
+    memcpy(header.common.magic, ACEP_VERSION_MAGIC, sizeof(header.common.magic));
+    header.version = ACEP_HEADER_VERSION;
+    header.headerSize = headerSize;
+    header.format = formats[outputFormat];
+    header.flags = ACEP_FLAG_CRC;
+    header.crc = calculateCrc32(p + headerSize, dataSize);
+    if (hasBandTable(width, height)) {
+        header.flags |= ACEP_FLAG_BANDS;
+        writeBandTable(p + sizeof(header), p + headerSize);
+    }
+    memcpy(p, &header, sizeof(header));
+}
+
+static bool checkSize(const std::string &path, QoiDecoder &decoder, uint32_t width, uint32_t height,
+        bool isLargerAllowed = false)
+{
+    bool isExact = decoder.getWidth() == width && decoder.getHeight() == height;
+    if (!isExact && !(isLargerAllowed && decoder.getWidth() >= width && decoder.getHeight() >= height)) {
+        char message[64];
+        snprintf(message, sizeof(message), "size must be %s%ux%u", isLargerAllowed ? "at least " : "",
+                width, height);
+        printError(path, message);
+        return false;
+    }
+    return true;
+}
+
+static uint8_t getPixel(const uint8_t *pData, uint32_t rowBytes, uint32_t x, uint32_t y)
+{
+    uint8_t pair = pData[rowBytes * y + x / 2];
+    return (x & 1) ? pair & 0x0F : pair >> 4;
+}
+
+static bool verifyFile(const std::string &outputPath, const uint8_t *pImage, uint32_t width)
+{
+    // The output is displayed as the firmware does, and each pixel on the panel is compared
+    // with the quantized image at the top left, doubled or rotated by 90 degrees
+    std::lock_guard<std::mutex> lock(verifyMutex);
+    char absPath[PATH_MAX];
+    if (!realpath(outputPath.c_str(), absPath) || !acep.clearDisplay() || !acep.displayACePDataFromSD(absPath)) {
+        printError(outputPath, "can't be displayed");
+        return false;
+    }
+    const uint8_t *pFrame = pEmulator->getFrame();
+    uint32_t rowBytes = width / 2;
+    for (uint32_t y = 0; y < Controller::HEIGHT; y++) {
+        for (uint32_t x = 0; x < Controller::WIDTH; x++) {
+            uint8_t expected;
+            if (outputFormat == FORMAT_TILED) {
+                expected = getPixel(pImage, rowBytes, y, Controller::WIDTH - 1 - x);
+            } else if (outputFormat == FORMAT_HALF) {
+                expected = getPixel(pImage, rowBytes, x / 2, y / 2);
+            } else {
+                expected = getPixel(pImage, rowBytes, x, y);
+            }
+            if (getPixel(pFrame, Controller::ROW_BYTES, x, y) != expected) {
+                char message[64];
+                snprintf(message, sizeof(message), "differs on the panel at (%u, %u)", x, y);
+                printError(outputPath, message);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool decodeRow(QoiDecoder &decoder, Quantizer &quantizer, std::vector<uint8_t> &rgb,
+        uint8_t *pOut, uint32_t width, uint32_t y)
+{
+    if (!isErrorDiffusion) {
+        return decoder.decodeRow(pOut, width, y);
+    }
+    if (!decoder.decodeRowRGB(rgb.data(), width)) {
+        return false;
+    }
+    quantizer.quantizeRow(rgb.data(), pOut, y);
+    return true;
+}
+
+static bool convertFile(const std::string &path)
+{
+    // Absolute paths are given to the emulated SD card, whose root is empty
+    File file = SD.open(path.c_str());
+    QoiDecoder decoder;
+    if (!file || !decoder.begin(file)) {
+        printError(path, "not a QOI image");
+        file.close();
+        return false;
+    }
+    uint32_t width = decoder.getWidth(), height = decoder.getHeight();
+    bool isOK = (width % 2 == 0 && width <= UINT16_MAX && height <= UINT16_MAX);
+    if (!isOK) {
+        printError(path, "unsupported size");
+    } else if (outputFormat == FORMAT_TILED) {
+        isOK = checkSize(path, decoder, Controller::HEIGHT, Controller::WIDTH);
+    } else if (outputFormat == FORMAT_HALF) {
+        isOK = checkSize(path, decoder, Controller::WIDTH / 2, Controller::HEIGHT / 2);
+    } else {
+        // A raw image without header is told only by its file size, and a larger one
+        // needs the header to be cropped by the firmware
+        isOK = checkSize(path, decoder, Controller::WIDTH, Controller::HEIGHT,
+                outputFormat != FORMAT_RAW || isVersioned);
+    }
+
+    // The whole output is mapped at its final size and filled row by row
+    uint32_t rowBytes = width / 2;
+    uint32_t headerSize = isVersioned ? sizeof(ACePVersionHeader_T) :
+            (outputFormat == FORMAT_RAW) ? 0 : sizeof(ACePHeader_T);
+    if (isVersioned && hasBandTable(width, height)) {
+        headerSize += Controller::BAND_COUNT * sizeof(uint16_t);
+    }
+    uint32_t tilesPerColumn = (height + ACEP_TILE_H - 1) / ACEP_TILE_H;
+    uint32_t dataSize = (outputFormat == FORMAT_TILED) ?
+            width / ACEP_TILE_W * tilesPerColumn * ACEP_TILE_BYTES : rowBytes * height;
+    std::string name = path.substr(path.rfind('/') + 1);
+    std::string outputPath = std::string(pOutputDir) + "/" + name.substr(0, name.size() - 4) + ".acp";
+    int fd = -1;
+    uint8_t *pMap = (uint8_t *)MAP_FAILED;
+    if (isOK) {
+        fd = open(outputPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        isOK = fd >= 0 && ftruncate(fd, headerSize + dataSize) == 0;
+        if (isOK) {
+            pMap = (uint8_t *)mmap(NULL, headerSize + dataSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            isOK = pMap != MAP_FAILED;
+        }
+        if (!isOK) {
+            printError(outputPath, strerror(errno));
+        }
+    }
+
+    Quantizer quantizer(width, metric, isSerpentine, kernel);
+    std::vector<uint8_t> rgb(width * 3);
+    if (isOK && outputFormat == FORMAT_TILED) {
+        // Tiles of 2 x 64 pixels are stored column by column, and the last ones are padded
+        std::vector<uint8_t> image(rowBytes * tilesPerColumn * ACEP_TILE_H, WHITE << 4 | WHITE);
+        for (uint32_t y = 0; y < height && isOK; y++) {
+            isOK = decodeRow(decoder, quantizer, rgb, &image[rowBytes * y], width, y);
+        }
+        uint8_t *p = pMap + headerSize;
+        for (uint32_t x = 0; x < rowBytes; x++) {
+            for (uint32_t y = 0; y < tilesPerColumn * ACEP_TILE_H; y++) {
+                *p++ = image[rowBytes * y + x];
+            }
+        }
+        if (isOK) {
+            writeHeader(pMap, width, height, headerSize, dataSize);
+            isOK = !isVerify || verifyFile(outputPath, image.data(), width);
+        }
+    } else if (isOK) {
+        for (uint32_t y = 0; y < height && isOK; y++) {
+            isOK = decodeRow(decoder, quantizer, rgb, pMap + headerSize + rowBytes * y, width, y);
+        }
+        if (isOK) {
+            writeHeader(pMap, width, height, headerSize, dataSize);
+            isOK = !isVerify || verifyFile(outputPath, pMap + headerSize, width);
+        }
+    }
+    if (pMap != MAP_FAILED) {
+        munmap(pMap, headerSize + dataSize);
+        if (!isOK && !isVerify) {
+            printError(path, "broken QOI data");
+        }
+    }
+    if (fd >= 0) {
+        close(fd);
+        if (!isOK) {
+            unlink(outputPath.c_str());
+        }
+    }
+    file.close();
+    return isOK;
+}
+
+static int benchmark(const std::string &path)
+{
+    // Each kernel quantizes the whole image repeatedly for a second
+    File file = SD.open(path.c_str());
+    QoiDecoder decoder;
+    if (!file || !decoder.begin(file) || decoder.getWidth() % 2 || decoder.getWidth() > UINT16_MAX) {
+        printError(path, "not a QOI image");
+        return 1;
+    }
+    uint32_t width = decoder.getWidth(), height = decoder.getHeight();
+    std::vector<uint8_t> rgb(width * 3 * height), reference, out(width / 2 * height);
+    for (uint32_t y = 0; y < height; y++) {
+        if (!decoder.decodeRowRGB(&rgb[width * 3 * y], width)) {
+            printError(path, "broken QOI data");
+            return 1;
+        }
+    }
+    file.close();
+    printf("%ux%u, %s distance%s\n", width, height, (metric == METRIC_LAB) ? "Lab" : "RGB",
+            isSerpentine ? ", serpentine" : "");
+    double baseRate = 0.0;
+    for (int k = KERNEL_SCALAR; k <= Quantizer::getBestKernel(); k++) {
+        uint32_t frames = 0;
+        auto start = std::chrono::steady_clock::now();
+        double elapsed;
+        do {
+            Quantizer quantizer(width, metric, isSerpentine, (QUANTIZER_KERNEL)k);
+            for (uint32_t y = 0; y < height; y++) {
+                quantizer.quantizeRow(&rgb[width * 3 * y], &out[width / 2 * y], y);
+            }
+            frames++;
+            elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        } while (elapsed < 1.0);
+        double rate = (double)width * height * frames / elapsed / 1.0e6;
+        if (k == KERNEL_SCALAR) {
+            reference = out;
+            baseRate = rate;
+        }
+        printf("%-6s %7.2f MP/s (x%.2f) %s\n", Quantizer::getKernelName((QUANTIZER_KERNEL)k), rate,
+                rate / baseRate, (out == reference) ? "same" : "DIFFERENT");
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned threadCount = std::thread::hardware_concurrency();
+    bool isBenchmark = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-fs") == 0) {
+            isErrorDiffusion = true;
+        } else if (strcmp(argv[i], "-serpentine") == 0) {
+            isSerpentine = true;
+        } else if (strcmp(argv[i], "-lab") == 0) {
+            metric = METRIC_LAB;
+        } else if (strcmp(argv[i], "-scalar") == 0) {
+            kernel = KERNEL_SCALAR;
+        } else if (strcmp(argv[i], "-bench") == 0) {
+            isBenchmark = true;
+        } else if (strcmp(argv[i], "-verify") == 0) {
+            isVerify = true;
+        } else if (strcmp(argv[i], "-header") == 0) {
+            outputFormat = FORMAT_HEADER;
+        } else if (strcmp(argv[i], "-tiled") == 0) {
+            outputFormat = FORMAT_TILED;
+        } else if (strcmp(argv[i], "-half") == 0) {
+            outputFormat = FORMAT_HALF;
+        } else if (strcmp(argv[i], "-crc") == 0) {
+            isVersioned = true;
+        } else if (strcmp(argv[i], "-bands") == 0) {
+            isVersioned = isBandTable = true;
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            threadCount = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            pOutputDir = argv[++i];
+        } else if (argv[i][0] != '-') {
+            addInputPath(argv[i]);
+        } else {
+            inputPaths.clear();
+            break;
+        }
+    }
+    if (inputPaths.empty()) {
+        printf("Usage: %s [-header | -tiled | -half] [-crc] [-bands] [-fs [-serpentine] [-lab] [-scalar]] [-j threads] [-o dir] [-verify] "
+                "(image.qoi | dir)...\n       %s -bench [-serpentine] [-lab] image.qoi\n", argv[0], argv[0]);
+        return 2;
+    }
+    SD.setRoot("");
+    if (isBenchmark) {
+        return benchmark(inputPaths[0]);
+    }
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+    UC8159Emulator emulator(!ACEP_PANEL::HAS_REFRESH_PARAM);
+    if (isVerify) {
+        pEmulator = &emulator;
+        acep.setup();
+        acep.initialize();
+    }
+
+    std::atomic<size_t> next(0);
+    std::atomic<unsigned> failures(0);
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threadCount && i < inputPaths.size(); i++) {
+        workers.emplace_back([&]() {
+            size_t j;
+            while ((j = next++) < inputPaths.size()) {
+                if (!convertFile(inputPaths[j])) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    printf("%u converted, %u failed\n", (unsigned)(inputPaths.size() - failures), (unsigned)failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,265 @@
+/**
+ * ArduinoACePCalendar : "HostArduino.cpp"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <ctype.h>
+#include <sys/stat.h>
+#include <arduino.h>
+#include <SPI.h>
+#include <SD.h>
+#include "HostArduino.h"
+
+SPIClass        SPI;
+SDClass         SD;
+UC8159Emulator  *pEmulator = NULL;
+
+static uint8_t  pinLevels[32];
+static uint32_t virtualMicros = 0;
+
+/*---------------------------------------------------------------------------*/
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    if (pin < sizeof(pinLevels) && mode != OUTPUT) {
+        pinLevels[pin] = HIGH;
+    }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    if (pin < sizeof(pinLevels)) {
+        if (pin == ACEP_RESET_PIN && pinLevels[pin] == LOW && value == HIGH && pEmulator) {
+            pEmulator->reset();
+        }
+        pinLevels[pin] = value;
+    }
+}
+
+int digitalRead(uint8_t pin)
+{
+    if (pin == ACEP_BUSY_PIN && pEmulator) {
+        return pEmulator->isBusyHigh() ? HIGH : LOW;
+    }
+    return (pin < sizeof(pinLevels)) ? pinLevels[pin] : LOW;
+}
+
+void delay(uint32_t ms)
+{
+    virtualMicros += ms * 1000;
+}
+
+void delayMicroseconds(uint16_t us)
+{
+    virtualMicros += us;
+}
+
+uint32_t millis(void)
+{
+    return virtualMicros / 1000;
+}
+
+uint32_t micros(void)
+{
+    return virtualMicros;
+}
+
+/*---------------------------------------------------------------------------*/
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+    if (pinLevels[ACEP_CS_PIN] == LOW && pEmulator) {
+        pEmulator->receive(pinLevels[ACEP_DC_PIN] == HIGH, data);
+    }
+    virtualMicros += 4; // 8 bits at 2MHz
+    return 0xFF;
+}
+
+void SPIClass::transfer(void *pBuf, size_t count)
+{
+    uint8_t *p = (uint8_t *)pBuf;
+    while (count-- > 0) {
+        *p = transfer(*p);
+        p++;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+
+int File::read(void)
+{
+    return pFile ? fgetc(pFile) : -1;
+}
+
+int File::read(void *pBuf, uint16_t len)
+{
+    return pFile ? fread(pBuf, 1, len, pFile) : -1;
+}
+
+size_t File::write(const uint8_t *pBuf, size_t len)
+{
+    return pFile ? fwrite(pBuf, 1, len, pFile) : 0;
+}
+
+size_t File::write(uint8_t data)
+{
+    return write(&data, 1);
+}
+
+bool File::seek(uint32_t pos)
+{
+    return pFile && fseek(pFile, pos, SEEK_SET) == 0;
+}
+
+uint32_t File::position(void)
+{
+    return pFile ? ftell(pFile) : 0;
+}
+
+int File::available(void)
+{
+    return pFile ? fileSize - position() : 0;
+}
+
+void File::flush(void)
+{
+    if (pFile) {
+        fflush(pFile);
+    }
+}
+
+void File::close(void)
+{
+    if (pFile) {
+        fclose(pFile);
+        pFile = NULL;
+    }
+    if (pDir) {
+        closedir(pDir);
+        pDir = NULL;
+    }
+}
+
+File File::openNextFile(uint8_t mode)
+{
+    File file;
+    struct dirent *pEntry;
+    while (pDir && (pEntry = readdir(pDir))) {
+        if (pEntry->d_name[0] != '.') {
+            char path[sizeof(filePath)];
+            snprintf(path, sizeof(path), "%s/%s", filePath, pEntry->d_name);
+            if (file.openPath(path, pEntry->d_name, mode)) {
+                break;
+            }
+        }
+    }
+    return file;
+}
+
+void File::rewindDirectory(void)
+{
+    if (pDir) {
+        rewinddir(pDir);
+    }
+}
+
+bool File::openPath(const char *path, const char *name, uint8_t mode)
+{
+    struct stat st;
+    bool isExisting = stat(path, &st) == 0;
+    if (isExisting && S_ISDIR(st.st_mode)) {
+        pDir = opendir(path);
+    } else if (isExisting || mode == FILE_WRITE) {
+        pFile = fopen(path, (mode == FILE_WRITE) ? (isExisting ? "r+b" : "w+b") : "rb");
+        if (pFile && mode == FILE_WRITE) {
+            fseek(pFile, 0, SEEK_END);
+        }
+    }
+    if (!pFile && !pDir) {
+        return false;
+    }
+    fileSize = (pFile) ? st.st_size : 0;
+    snprintf(filePath, sizeof(filePath), "%s", path);
+    uint8_t i;
+    for (i = 0; i < sizeof(fileName) - 1 && name[i]; i++) {
+        fileName[i] = toupper(name[i]); // as the 8.3 names of SD library
+    }
+    fileName[i] = '\0';
+    return true;
+}
+
+/*---------------------------------------------------------------------------*/
+
+void SDClass::setRoot(const char *path)
+{
+    snprintf(rootPath, sizeof(rootPath), "%s", path);
+}
+
+File SDClass::open(const char *path, uint8_t mode)
+{
+    char hostPath[256];
+    resolvePath(path, hostPath, sizeof(hostPath));
+    const char *name = strrchr(path, '/');
+    File file;
+    file.openPath(hostPath, name ? name + 1 : path, mode);
+    return file;
+}
+
+bool SDClass::exists(const char *path)
+{
+    File file = open(path);
+    bool ret = file;
+    file.close();
+    return ret;
+}
+
+bool SDClass::remove(const char *path)
+{
+    char hostPath[256];
+    resolvePath(path, hostPath, sizeof(hostPath));
+    return ::remove(hostPath) == 0;
+}
+
+void SDClass::resolvePath(const char *path, char *hostPath, size_t len)
+{
+    // FAT file names are case-insensitive
+    snprintf(hostPath, len, "%s/%s", rootPath, path);
+    struct stat st;
+    const char *name = strrchr(path, '/');
+    if (stat(hostPath, &st) == 0 || (name && name[1] == '\0')) {
+        return;
+    }
+    name = name ? name + 1 : path;
+    char dirPath[256];
+    snprintf(dirPath, sizeof(dirPath), "%s/%.*s", rootPath, (int)(name - path), path);
+    DIR *pDir = opendir(dirPath);
+    struct dirent *pEntry;
+    while (pDir && (pEntry = readdir(pDir))) {
+        if (strcasecmp(pEntry->d_name, name) == 0) {
+            snprintf(hostPath, len, "%s/%s", dirPath, pEntry->d_name);
+            break;
+        }
+    }
+    if (pDir) {
+        closedir(pDir);
+    }
+}
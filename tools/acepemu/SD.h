@@ -0,0 +1,131 @@
+/**
+ * ArduinoACePCalendar : "SD.h"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <arduino.h>
+#include <stdio.h>
+#include <dirent.h>
+
+#define FILE_READ   0
+#define FILE_WRITE  1
+
+#define SPI_FULL_SPEED  0
+#define SPI_HALF_SPEED  1
+
+// Files of the emulated microSD card are taken from a host directory.
+
+class File
+{
+public:
+    File() : pFile(NULL), pDir(NULL), fileSize(0)
+    {
+        fileName[0] = '\0';
+    }
+
+    operator bool(void) const
+    {
+        return pFile || pDir;
+    }
+    int read(void);
+    int read(void *pBuf, uint16_t len);
+    size_t write(const uint8_t *pBuf, size_t len);
+    size_t write(uint8_t data);
+    bool seek(uint32_t pos);
+    uint32_t position(void);
+    uint32_t size(void)
+    {
+        return fileSize;
+    }
+    int available(void);
+    void flush(void);
+    void close(void);
+    bool isDirectory(void)
+    {
+        return pDir != NULL;
+    }
+    File openNextFile(uint8_t mode = FILE_READ);
+    void rewindDirectory(void);
+    char *name(void)
+    {
+        return fileName;
+    }
+
+private:
+    friend class SDClass;
+    bool openPath(const char *path, const char *name, uint8_t mode);
+
+    FILE    *pFile;
+    DIR     *pDir;
+    uint32_t fileSize;
+    char    filePath[256];
+    char    fileName[13];
+};
+
+// Raw card access is not emulated.
+
+class Sd2Card
+{
+public:
+    bool init(uint8_t sckRateID, uint8_t chipSelectPin)
+    {
+        return false;
+    }
+    void partialBlockRead(bool value)
+    {}
+    bool readData(uint32_t block, uint16_t offset, uint16_t count, uint8_t *dst)
+    {
+        return false;
+    }
+};
+
+class SDClass
+{
+public:
+    SDClass()
+    {
+        setRoot(".");
+    }
+    void setRoot(const char *path);
+    bool begin(uint8_t csPin)
+    {
+        return true;
+    }
+    void end(void)
+    {}
+    File open(const char *path, uint8_t mode = FILE_READ);
+    File open(const __FlashStringHelper *path, uint8_t mode = FILE_READ)
+    {
+        return open(reinterpret_cast<const char *>(path), mode);
+    }
+    bool exists(const char *path);
+    bool remove(const char *path);
+
+private:
+    void resolvePath(const char *path, char *hostPath, size_t len);
+
+    char rootPath[256];
+};
+
+extern SDClass SD;
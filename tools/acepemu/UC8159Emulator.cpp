@@ -0,0 +1,238 @@
+/**
+ * ArduinoACePCalendar : "UC8159Emulator.cpp"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include "UC8159Emulator.h"
+
+enum : uint8_t {
+    CMD_POWER_OFF = 0x02,
+    CMD_POWER_ON = 0x04,
+    CMD_SLEEP = 0x07,
+    CMD_DATA_START = 0x10,
+    CMD_DISPLAY_REFRESH = 0x12,
+    CMD_RESOLUTION = 0x61,
+    CMD_PARTIAL_WINDOW = 0x90,
+    CMD_PARTIAL_IN = 0x91,
+    CMD_PARTIAL_OUT = 0x92,
+};
+
+static const uint8_t palette[8][3] = {
+    { 0, 0, 0 }, { 255, 255, 255 }, { 0, 128, 0 }, { 0, 0, 255 },
+    { 255, 0, 0 }, { 255, 255, 0 }, { 255, 170, 0 }, { 255, 0, 255 }, // 7: invalid (magenta)
+};
+
+/*---------------------------------------------------------------------------*/
+
+void UC8159Emulator::reset(void)
+{
+    command = 0;
+    paramCount = 0;
+    width = 600;
+    height = 448;
+    frame.assign((uint32_t)width * height / 2, 0x11);
+    writePos = 0;
+    refreshCount = 0;
+    isPowerOn = false;
+    isPowerOff = false;
+    isPartial = false;
+    setWindow(0, 0, width - 1, height - 1);
+}
+
+void UC8159Emulator::receive(bool isData, uint8_t value)
+{
+    if (isData) {
+        handleData(value);
+    } else {
+        handleCommand(value);
+    }
+}
+
+void UC8159Emulator::setRefreshHandler(void (*pHandler)(const UC8159Emulator &emulator))
+{
+    pRefreshHandler = pHandler;
+}
+
+uint32_t UC8159Emulator::getWindowDataLength(void) const
+{
+    return (uint32_t)(windowRight - windowLeft + 1) * (windowBottom - windowTop + 1) / 2;
+}
+
+bool UC8159Emulator::isBusyHigh(void) const
+{
+    return !(isPowerOff && isBusyLowAfterPowerOff);
+}
+
+bool UC8159Emulator::writePNG(const char *path) const
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        return false;
+    }
+
+    // Image data are stored with uncompressed deflate blocks
+    std::vector<uint8_t> raw;
+    raw.reserve((uint32_t)(width * 3 + 1) * height);
+    for (uint16_t y = 0; y < height; y++) {
+        raw.push_back(0);
+        for (uint16_t x = 0; x < width; x++) {
+            uint8_t b = frame[((uint32_t)y * width + x) / 2];
+            const uint8_t *pColor = palette[((x & 1) ? b : b >> 4) & 7];
+            raw.insert(raw.end(), pColor, pColor + 3);
+        }
+    }
+    std::vector<uint8_t> zlib = { 0x78, 0x01 };
+    uint32_t a = 1, b = 0;
+    size_t pos = 0;
+    do {
+        uint16_t len = (raw.size() - pos > 65535) ? 65535 : raw.size() - pos;
+        zlib.push_back(pos + len == raw.size());
+        zlib.push_back(len & 0xFF);
+        zlib.push_back(len >> 8);
+        zlib.push_back(~len & 0xFF);
+        zlib.push_back(~len >> 8 & 0xFF);
+        for (uint16_t i = 0; i < len; i++, pos++) {
+            zlib.push_back(raw[pos]);
+            a = (a + raw[pos]) % 65521;
+            b = (b + a) % 65521;
+        }
+    } while (pos < raw.size());
+    uint32_t adler = b << 16 | a;
+    for (int8_t i = 3; i >= 0; i--) {
+        zlib.push_back(adler >> i * 8 & 0xFF);
+    }
+
+    static uint32_t crcTable[256];
+    if (!crcTable[1]) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (uint8_t k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            }
+            crcTable[n] = c;
+        }
+    }
+    auto writeChunk = [fp](const char *type, const std::vector<uint8_t> &data) {
+        std::vector<uint8_t> chunk(type, type + 4);
+        chunk.insert(chunk.end(), data.begin(), data.end());
+        uint32_t len = data.size(), crc = 0xFFFFFFFF;
+        for (uint8_t c : chunk) {
+            crc = crcTable[(crc ^ c) & 0xFF] ^ (crc >> 8);
+        }
+        crc ^= 0xFFFFFFFF;
+        const uint8_t lenBytes[] = { (uint8_t)(len >> 24), (uint8_t)(len >> 16), (uint8_t)(len >> 8), (uint8_t)len };
+        const uint8_t crcBytes[] = { (uint8_t)(crc >> 24), (uint8_t)(crc >> 16), (uint8_t)(crc >> 8), (uint8_t)crc };
+        fwrite(lenBytes, 1, 4, fp);
+        fwrite(chunk.data(), 1, chunk.size(), fp);
+        fwrite(crcBytes, 1, 4, fp);
+    };
+    static const uint8_t signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    fwrite(signature, 1, sizeof(signature), fp);
+    writeChunk("IHDR", { 0, 0, (uint8_t)(width >> 8), (uint8_t)width, 0, 0, (uint8_t)(height >> 8), (uint8_t)height,
+            8, 2, 0, 0, 0 });
+    writeChunk("IDAT", zlib);
+    writeChunk("IEND", {});
+    return fclose(fp) == 0;
+}
+
+/*---------------------------------------------------------------------------*/
+
+void UC8159Emulator::handleCommand(uint8_t value)
+{
+    command = value;
+    paramCount = 0;
+    isPowerOff = false;
+    switch (command) {
+        case CMD_POWER_OFF:
+            isPowerOn = false;
+            isPowerOff = true;
+            break;
+        case CMD_POWER_ON:
+            isPowerOn = true;
+            break;
+        case CMD_DATA_START:
+            writePos = 0;
+            break;
+        case CMD_PARTIAL_IN:
+            isPartial = true;
+            break;
+        case CMD_PARTIAL_OUT:
+            isPartial = false;
+            setWindow(0, 0, width - 1, height - 1);
+            break;
+        case CMD_DISPLAY_REFRESH:
+            if (!isPowerOn) {
+                fprintf(stderr, "Warning: display refresh without power on\n");
+            }
+            refreshCount++;
+            if (pRefreshHandler) {
+                pRefreshHandler(*this);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void UC8159Emulator::handleData(uint8_t data)
+{
+    if (paramCount < sizeof(params)) {
+        params[paramCount] = data;
+    }
+    paramCount++;
+    switch (command) {
+        case CMD_DATA_START:
+            if (writePos < getWindowDataLength()) {
+                uint16_t windowRowBytes = (windowRight - windowLeft + 1) / 2;
+                uint32_t pos = ((uint32_t)(windowTop + writePos / windowRowBytes) * width + windowLeft) / 2 +
+                        writePos % windowRowBytes;
+                frame[pos] = data;
+            }
+            writePos++;
+            break;
+        case CMD_RESOLUTION:
+            if (paramCount == 4) {
+                width = params[0] << 8 | params[1];
+                height = params[2] << 8 | params[3];
+                frame.resize((uint32_t)width * height / 2, 0x11);
+                setWindow(0, 0, width - 1, height - 1);
+            }
+            break;
+        case CMD_PARTIAL_WINDOW:
+            if (paramCount == 9 && isPartial) {
+                setWindow(params[0] << 8 | params[1], params[4] << 8 | params[5],
+                        params[2] << 8 | params[3], params[6] << 8 | params[7]);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void UC8159Emulator::setWindow(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom)
+{
+    windowLeft = left & ~1;
+    windowTop = top;
+    windowRight = (right < width) ? right | 1 : width - 1;
+    windowBottom = (bottom < height) ? bottom : height - 1;
+}
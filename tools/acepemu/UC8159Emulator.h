@@ -0,0 +1,86 @@
+/**
+ * ArduinoACePCalendar : "UC8159Emulator.h"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+// Software model of the ACeP panel controller which interprets the command / data
+// byte stream and keeps the frame memory in the .acp layout (2 pixels / byte).
+
+class UC8159Emulator
+{
+public:
+    UC8159Emulator(bool isBusyLowAfterPowerOff = true)
+        : isBusyLowAfterPowerOff(isBusyLowAfterPowerOff), pRefreshHandler(NULL)
+    {
+        reset();
+    }
+    ~UC8159Emulator()
+    {}
+
+    void reset(void);
+    void receive(bool isData, uint8_t value);
+    void setRefreshHandler(void (*pHandler)(const UC8159Emulator &emulator));
+    bool isBusyHigh(void) const;
+    uint16_t getWidth(void) const
+    {
+        return width;
+    }
+    uint16_t getHeight(void) const
+    {
+        return height;
+    }
+    uint32_t getReceivedDataLength(void) const
+    {
+        return writePos;
+    }
+    uint32_t getWindowDataLength(void) const;
+    uint16_t getRefreshCount(void) const
+    {
+        return refreshCount;
+    }
+    const uint8_t *getFrame(void) const
+    {
+        return frame.data();
+    }
+    bool writePNG(const char *path) const;
+
+private:
+    void handleCommand(uint8_t command);
+    void handleData(uint8_t data);
+    void setWindow(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
+
+    const bool isBusyLowAfterPowerOff;
+    void (*pRefreshHandler)(const UC8159Emulator &emulator);
+    std::vector<uint8_t> frame;
+    uint8_t command, params[10];
+    uint16_t paramCount;
+    uint16_t width, height;
+    uint16_t windowLeft, windowTop, windowRight, windowBottom;
+    uint32_t writePos;
+    uint16_t refreshCount;
+    bool isPowerOn, isPowerOff, isPartial;
+};
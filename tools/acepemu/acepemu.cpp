@@ -0,0 +1,196 @@
+/**
+ * ArduinoACePCalendar : "acepemu.cpp"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Renders what the firmware sends to the panel into PNG files.
+//
+// Build:
+//   g++ -std=c++11 -O2 -I. -o acepemu acepemu.cpp HostArduino.cpp UC8159Emulator.cpp ../../ACePController.cpp ../../QoiDecoder.cpp
+
+#include <stdio.h>
+#include <SD.h>
+#include "HostArduino.h"
+#include "../../testpatterndata.h"
+
+static ACePController<ACEP_PANEL> acep;
+static const char *pOutputPath = "out.png";
+static const char *pGoldenPath = NULL;
+static bool isMatched = true;
+
+static bool isSameFile(const char *path1, const char *path2)
+{
+    FILE *fp1 = fopen(path1, "rb"), *fp2 = fopen(path2, "rb");
+    bool ret = fp1 && fp2;
+    while (ret) {
+        int c1 = fgetc(fp1), c2 = fgetc(fp2);
+        ret = c1 == c2;
+        if (c1 == EOF) {
+            break;
+        }
+    }
+    if (fp1) {
+        fclose(fp1);
+    }
+    if (fp2) {
+        fclose(fp2);
+    }
+    return ret;
+}
+
+static void onRefresh(const UC8159Emulator &emulator)
+{
+    uint32_t expected = emulator.getWindowDataLength();
+    if (emulator.getReceivedDataLength() != expected) {
+        fprintf(stderr, "Warning: %u bytes received for %ux%u frame (expected %u)\n",
+                emulator.getReceivedDataLength(), emulator.getWidth(), emulator.getHeight(), expected);
+    }
+    char path[256];
+    if (emulator.getRefreshCount() == 1) {
+        snprintf(path, sizeof(path), "%s", pOutputPath);
+    } else {
+        snprintf(path, sizeof(path), "%.*s_%u.png", (int)(strlen(pOutputPath) - 4), pOutputPath,
+                emulator.getRefreshCount());
+    }
+    if (!emulator.writePNG(path)) {
+        fprintf(stderr, "Error: cannot write %s\n", path);
+        isMatched = false;
+        return;
+    }
+    printf("Frame %u: %s (%ums)\n", emulator.getRefreshCount(), path, millis());
+    if (pGoldenPath && emulator.getRefreshCount() == 1 && !isSameFile(path, pGoldenPath)) {
+        fprintf(stderr, "Mismatch: %s differs from %s\n", path, pGoldenPath);
+        isMatched = false;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *pImagePath = NULL, *pNextPath = NULL;
+    char imagePaths[LAYOUT_QUARTERS][PATH_LEN_MAX];
+    int test = -1, color = -1, layout = LAYOUT_FULL, imageCount = 0;
+    unsigned year = 0, month = 0, day = 0, nextYear = 0, nextMonth = 0, nextDay = 0;
+    int hour = -1, minute = 0, bandHour = -1, bandMinute = 0;
+    unsigned viewX = 0, viewY = 0;
+    ACEP_ROTATION rotation = ROTATE_90;
+    const char *pColors = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-date") == 0 && i + 1 < argc) {
+            sscanf(argv[++i], "%4u%2u%2u", &year, &month, &day);
+        } else if (strcmp(argv[i], "-time") == 0 && i + 1 < argc) {
+            sscanf(argv[++i], "%2d%2d", &hour, &minute);
+        } else if (strcmp(argv[i], "-band") == 0 && i + 1 < argc) {
+            sscanf(argv[++i], "%2d%2d", &bandHour, &bandMinute);
+        } else if (strcmp(argv[i], "-next") == 0 && i + 1 < argc) {
+            pNextPath = argv[++i];
+        } else if (strcmp(argv[i], "-nextdate") == 0 && i + 1 < argc) {
+            sscanf(argv[++i], "%4u%2u%2u", &nextYear, &nextMonth, &nextDay);
+        } else if (strcmp(argv[i], "-view") == 0 && i + 1 < argc) {
+            sscanf(argv[++i], "%u,%u", &viewX, &viewY);
+        } else if (strcmp(argv[i], "-rotate") == 0 && i + 1 < argc) {
+            rotation = (atoi(argv[++i]) == 270) ? ROTATE_270 : ROTATE_90;
+        } else if (strcmp(argv[i], "-colors") == 0 && i + 1 < argc) {
+            pColors = argv[++i];
+        } else if (strcmp(argv[i], "-layout") == 0 && i + 1 < argc) {
+            layout = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-test") == 0 && i + 1 < argc) {
+            test = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-clear") == 0 && i + 1 < argc) {
+            color = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-sd") == 0 && i + 1 < argc) {
+            SD.setRoot(argv[++i]);
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            pOutputPath = argv[++i];
+        } else if (strcmp(argv[i], "-golden") == 0 && i + 1 < argc) {
+            pGoldenPath = argv[++i];
+        } else if (argv[i][0] != '-' && imageCount < LAYOUT_QUARTERS) {
+            pImagePath = argv[i];
+            snprintf(imagePaths[imageCount++], PATH_LEN_MAX, "%s", argv[i]);
+        } else {
+            pImagePath = NULL;
+            test = color = -1;
+            break;
+        }
+    }
+    if (!pImagePath && test < 0 && color < 0) {
+        printf("Usage: %s [-sd dir] [-date yyyymmdd] [-time HHMM] [-band HHMM] [-next image.acp [-nextdate yyyymmdd]] [-view x,y] [-rotate 90|270] [-colors 0123456] [-o out.png] [-golden ref.png] "
+                "(-clear 0-6 | -test 1-3 | image.acp | -layout 2|4 image.acp...)\n", argv[0]);
+        return 2;
+    }
+
+    UC8159Emulator emulator(!ACEP_PANEL::HAS_REFRESH_PARAM);
+    emulator.setRefreshHandler(onRefresh);
+    pEmulator = &emulator;
+
+    acep.setup();
+    acep.initialize();
+    bool isDisplayDate = year > 0;
+    if (isDisplayDate) {
+        acep.setDate(year, month, day);
+    }
+    if (hour >= 0) {
+        acep.setTime(hour, minute);
+    }
+    acep.setViewport(viewX, viewY);
+    acep.setRotation(rotation);
+    if (pColors && strlen(pColors) == ACEP_COLORS) {
+        uint8_t colorMap[ACEP_COLORS];
+        for (int i = 0; i < ACEP_COLORS; i++) {
+            colorMap[i] = pColors[i] - '0';
+        }
+        acep.setColorMap(colorMap);
+    }
+    bool isOK;
+    if (color >= 0) {
+        isOK = acep.clearDisplay((ACEP_COLOR)color);
+    } else if (test == 3) {
+        isOK = acep.displayACePDataFromPGM(imgTestPattern, IMG_TEST_PATTERN_WIDTH, IMG_TEST_PATTERN_HEIGHT,
+                isDisplayDate);
+    } else if (test >= 0) {
+        isOK = acep.displayACePTestPattern(test == 2);
+    } else if (layout != LAYOUT_FULL) {
+        isOK = imageCount == layout &&
+                acep.displayACePCollageFromSD(imagePaths, (ACEP_LAYOUT)layout, isDisplayDate);
+    } else {
+        isOK = acep.displayACePDataFromSD(pImagePath, isDisplayDate);
+        if (isOK && bandHour >= 0) {
+            acep.setTime(bandHour, bandMinute);
+            isOK = acep.updateTimeBand(pImagePath);
+        }
+        if (isOK && pNextPath) {
+            // Only the bands which differ are updated if possible, as the sketch does
+            if (nextYear > 0) {
+                acep.setDate(nextYear, nextMonth, nextDay);
+            }
+            if (!acep.canUpdateBands(pNextPath)) {
+                isOK = acep.clearDisplay();
+            }
+            isOK = isOK && acep.displayACePDataFromSD(pNextPath, isDisplayDate);
+        }
+    }
+    acep.finish();
+    if (!isOK || emulator.getRefreshCount() == 0) {
+        fprintf(stderr, "Error: nothing was displayed\n");
+        return 1;
+    }
+    return isMatched ? 0 : 1;
+}
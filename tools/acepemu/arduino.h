@@ -0,0 +1,62 @@
+/**
+ * ArduinoACePCalendar : "arduino.h"
+ *
+ * Copyright (c) 2022 OBONO
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+// Minimal host replacement of the Arduino core for acepemu
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define PROGMEM
+#define HIGH            1
+#define LOW             0
+#define INPUT           0
+#define OUTPUT          1
+#define INPUT_PULLUP    2
+#define MSBFIRST        1
+#define SPI_MODE0       0
+
+class __FlashStringHelper;
+#define F(str)  (reinterpret_cast<const __FlashStringHelper *>(str))
+
+#define pgm_read_byte(p)    (*(const uint8_t *)(p))
+#define pgm_read_word(p)    (*(const uint16_t *)(p))
+#define pgm_read_dword(p)   (*(const uint32_t *)(p))
+#define pgm_read_ptr(p)     (*(void * const *)(p))
+#define memcpy_P(d, s, n)   memcpy((d), (const void *)(s), (n))
+#define memcmp_P(a, b, n)   memcmp((a), (const void *)(b), (n))
+#define strncpy_P(d, s, n)  strncpy((d), (const char *)(s), (n))
+#define strncasecmp_P(a, b, n)  strncasecmp((a), (const char *)(b), (n))
+#define snprintf_P(d, n, f, ...)    snprintf((d), (n), (const char *)(f), ##__VA_ARGS__)
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void delay(uint32_t ms);
+void delayMicroseconds(uint16_t us);
+uint32_t millis(void);
+uint32_t micros(void);
@@ -0,0 +1,141 @@
+#!/usr/bin/python
+
+import pathlib
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+
+# Renders the sample images in each format through the emulator and compares the frames
+# with the golden images pixel by pixel. The inputs are made from the sample *.acp files,
+# so nothing but Python itself is needed. "-update" writes the golden images instead,
+# compressed because the emulator stores its PNG files uncompressed.
+#
+# Usage: python goldencheck.py [-update] path/to/acepemu
+
+WIDTH, HEIGHT = 600, 448
+ROW_BYTES = WIDTH // 2
+TILE_H = 64
+PALETTE = [(0, 0, 0), (255, 255, 255), (0, 255, 0), (0, 0, 255), (255, 0, 0), (255, 255, 0), (255, 128, 0)]
+
+TOOLS_DIR = pathlib.Path(__file__).resolve().parent.parent
+GOLDEN_DIR = pathlib.Path(__file__).resolve().parent / 'golden'
+
+def load_sample(number):
+	with open(TOOLS_DIR / ('sample%d.acp' % number), 'rb') as f:
+		return f.read()
+
+def get_pixel(data, row_bytes, x, y):
+	pair = data[row_bytes * y + x // 2]
+	return pair & 0x0F if x & 1 else pair >> 4
+
+def pack_pixels(pixels):
+	return bytes(pixels[i] << 4 | pixels[i + 1] for i in range(0, len(pixels), 2))
+
+def make_half(data):
+	rows = [pack_pixels([get_pixel(data, ROW_BYTES, x * 2, y * 2) for x in range(WIDTH // 2)])
+			for y in range(HEIGHT // 2)]
+	return b'ACeH' + struct.pack('<HH', WIDTH // 2, HEIGHT // 2) + b''.join(rows)
+
+def make_tiled(data):
+	# A portrait image of 448x600 taken by turning the sample, stored in tiles of 2x64
+	width, height = HEIGHT, WIDTH
+	tiles_per_column = (height + TILE_H - 1) // TILE_H
+	image = [[get_pixel(data, ROW_BYTES, y, HEIGHT - 1 - x) for x in range(width)] for y in range(height)]
+	image += [[1] * width] * (tiles_per_column * TILE_H - height)
+	body = bytes(image[y][x] << 4 | image[y][x + 1]
+			for x in range(0, width, 2) for y in range(tiles_per_column * TILE_H))
+	return b'ACeT' + struct.pack('<HH', width, height) + body
+
+def make_piece(data, layout, number):
+	# The left half or a quarter of the sample
+	width, height = WIDTH // 2, HEIGHT if layout == 2 else HEIGHT // 2
+	left, top = number % 2 * width, number // 2 * height
+	return b''.join(data[ROW_BYTES * y + left // 2:ROW_BYTES * y + (left + width) // 2]
+			for y in range(top, top + height))
+
+def make_qoi():
+	# Gradients between the palette colors, which are dithered by the decoder
+	out = bytearray(b'qoif' + struct.pack('>IIBB', WIDTH, HEIGHT, 3, 0))
+	for y in range(HEIGHT):
+		c0, c1 = PALETTE[y * 7 // HEIGHT], PALETTE[(y * 7 // HEIGHT + 1) % 7]
+		for x in range(WIDTH):
+			out += bytes([0xFE] + [(a * (WIDTH - x) + b * x) // WIDTH for a, b in zip(c0, c1)])
+	return bytes(out + b'\0' * 7 + b'\1')
+
+def read_png(path):
+	# Returns the header and the unfiltered image data; both writers use the filter type 0
+	with open(path, 'rb') as f:
+		data = f.read()
+	header, idat, pos = None, b'', 8
+	while pos < len(data):
+		length, chunk_type = struct.unpack('>I4s', data[pos:pos + 8])
+		if chunk_type == b'IHDR':
+			header = data[pos + 8:pos + 8 + length]
+		elif chunk_type == b'IDAT':
+			idat += data[pos + 8:pos + 8 + length]
+		pos += length + 12
+	return header, zlib.decompress(idat)
+
+def write_png(path, header, image):
+	def chunk(chunk_type, body):
+		return struct.pack('>I', len(body)) + chunk_type + body + \
+				struct.pack('>I', zlib.crc32(chunk_type + body))
+	with open(path, 'wb') as f:
+		f.write(b'\x89PNG\r\n\x1a\n' + chunk(b'IHDR', header) + chunk(b'IDAT', zlib.compress(image, 9)) +
+				chunk(b'IEND', b''))
+
+def make_cases(sd_dir):
+	files = {
+		'FULL.ACP': load_sample(1),
+		'HALF.ACP': make_half(load_sample(2)),
+		'TILED.ACP': make_tiled(load_sample(3)),
+		'GRAD.QOI': make_qoi(),
+	}
+	for i in range(2):
+		files['H%d.ACP' % i] = make_piece(load_sample(4 + i), 2, i)
+	for i in range(4):
+		files['Q%d.ACP' % i] = make_piece(load_sample(i), 4, i)
+	for name, data in files.items():
+		with open(sd_dir / name, 'wb') as f:
+			f.write(data)
+	return [
+		('full', ['FULL.ACP']),
+		('half', ['HALF.ACP']),
+		('tiled', ['TILED.ACP']),
+		('qoi', ['GRAD.QOI']),
+		('halves', ['-layout', '2', 'H0.ACP', 'H1.ACP']),
+		('quarters', ['-layout', '4', 'Q0.ACP', 'Q1.ACP', 'Q2.ACP', 'Q3.ACP']),
+		('date', ['-date', '20221001', 'FULL.ACP']),
+		('clock', ['-date', '20221001', '-time', '0930', 'HALF.ACP']),
+		('test', ['-date', '20221001', '-test', '3']),
+	]
+
+def main(args):
+	is_update = '-update' in args
+	args = [arg for arg in args if arg != '-update']
+	if len(args) != 1:
+		print('Usage: %s [-update] path/to/acepemu' % sys.argv[0])
+		return 2
+	GOLDEN_DIR.mkdir(exist_ok=True)
+	failures = 0
+	with tempfile.TemporaryDirectory() as temp_dir:
+		sd_dir = pathlib.Path(temp_dir)
+		cases = make_cases(sd_dir)
+		for name, options in cases:
+			golden_path = GOLDEN_DIR / (name + '.png')
+			output_path = sd_dir / (name + '.png')
+			command = [args[0], '-sd', str(sd_dir), '-o', str(output_path)]
+			is_ok = subprocess.run(command + options, stdout=subprocess.DEVNULL).returncode == 0
+			if is_ok and is_update:
+				write_png(golden_path, *read_png(output_path))
+			elif is_ok:
+				is_ok = golden_path.exists() and read_png(output_path) == read_png(golden_path)
+			print('%-8s %s' % (name, 'OK' if is_ok else 'FAILED'))
+			failures += not is_ok
+	print('%d passed, %d failed' % (len(cases) - failures, failures))
+	return 1 if failures else 0
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv[1:]))
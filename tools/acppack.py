@@ -0,0 +1,73 @@
+#!/usr/bin/python
+
+import pathlib
+import re
+import struct
+import sys
+
+# IMAGES.PAK = header + entry table + images, each image aligned to a block of the card.
+# The layout of each entry is taken from the size of the file, like the firmware does
+# for separate files.
+
+BLOCK_SIZE = 512
+NAME_LEN = 8
+
+def detect_layout(data, panel_size):
+	full_size = panel_size[0] * panel_size[1] // 2
+	if len(data) == full_size // 2 and data[:4] != b'qoif':
+		return 2
+	if len(data) == full_size // 4 and data[:4] != b'qoif':
+		return 4
+	return 1
+
+def make_pack(output_path, target_paths, panel_size):
+
+	entries = []
+	for filepath in target_paths:
+		with open(filepath, 'rb') as f:
+			data = f.read()
+		name = re.sub('[^0-9A-Z_]', '_', pathlib.PurePath(filepath).stem.upper())[:NAME_LEN]
+		layout = detect_layout(data, panel_size)
+		print('%-8s layout %d, %d bytes' % (name, layout, len(data)))
+		entries.append((name, layout, data))
+
+	offset = 8 + 20 * len(entries)
+	table = b''
+	body = b''
+	for name, layout, data in entries:
+		padding = -(offset + len(body)) % BLOCK_SIZE
+		body += b'\0' * padding
+		table += struct.pack('<IIB3x8s', offset + len(body), len(data), layout, name.encode())
+		body += data
+
+	with open(output_path, 'wb') as f:
+		f.write(b'ACPK' + struct.pack('<HH', len(entries), 0))
+		f.write(table)
+		f.write(body)
+	return
+
+if __name__ == '__main__':
+
+	output_path = 'IMAGES.PAK'
+	panel_size = (600, 448)
+	target_paths = []
+
+	argvs = sys.argv
+	i = 1
+	while i < len(argvs):
+		arg = argvs[i]
+		if arg == '-o' and i + 1 < len(argvs):
+			i += 1
+			output_path = argvs[i]
+		elif re.compile('^-\d+x\d+$').search(arg):
+			panel_size = tuple(int(n) for n in arg[1:].split('x'))
+		else:
+			target_paths.append(arg)
+		i += 1
+
+	if len(target_paths) == 0 or len(target_paths) > 65535:
+		print('Usage: %s [-o IMAGES.PAK] [-WxH] filename ...' % argvs[0])
+		quit()
+
+	make_pack(output_path, target_paths, panel_size)
+	print('Done!');
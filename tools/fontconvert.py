@@ -1,33 +1,80 @@
 #!/usr/bin/python
 
-import numpy as np
+import sys
 from PIL import Image
 
-filename = 'font.gif'
-img = Image.open(filename)
-
-img_data = np.asarray(img).reshape(-1, 4)
-for i in range(20):
-	max_y = 32
-	if i < 10:
-		max_y = 48
-	data = []
-	for y in range(max_y):
-		for x in range(0, 32, 4):
-			b = 0
-			for xx in range(4):
-				b += img.getpixel((i * 32 + x + xx, y)) << (xx * 2)
-			data.append(b)
-	counter = 0
-	out_str = ""
-	for b in data:
-		out_str += '0x' + format(b, '02X') + ','
-		counter += 1
-		if counter == 16:
-			out_str += '\n'
-			counter = 0
+# Each glyph row is stored as a sequence of runs which covers exactly 32 pixels.
+# A run byte consists of the 2-bit pixel value (bit 7 = opaque, bit 6 = foreground)
+# and the run length minus 1 (bits 0-5). Every glyph begins with a table of row
+# offsets (1 byte / row) into its own run data, so identical rows are shared.
+
+GLYPH_W = 32
+NUMBER_H = 48
+KANJI_H = 32
+GLYPHS = 21
+
+def encode_row(img, i, y):
+	runs = []
+	for x in range(GLYPH_W):
+		p = img.getpixel((i * GLYPH_W + x, y))
+		if not p & 2:
+			p = 0
+		if runs and runs[-1][0] == p and runs[-1][1] < 64:
+			runs[-1][1] += 1
 		else:
-			out_str += ' '
-	print('// Image %d' % i)
-	print(out_str)
+			runs.append([p, 1])
+	return bytes(p << 6 | (n - 1) for p, n in runs)
+
+def encode_glyph(img, i, height):
+	offsets = []
+	pool = b''
+	for y in range(height):
+		row = encode_row(img, i, y)
+		pos = pool.find(row)
+		if pos < 0:
+			pos = len(pool)
+			pool += row
+		offsets.append(pos)
+	if len(pool) > 256:
+		sys.exit('Glyph %d is too complex (%d bytes)' % (i, len(pool)))
+	runs = [len(encode_row(img, i, y)) for y in range(height)]
+	return bytes(offsets) + pool, runs
+
+def format_bytes(data):
+	out_str = ''
+	for pos in range(0, len(data), 16):
+		out_str += '    ' + ' '.join('0x%02X,' % b for b in data[pos:pos + 16]) + '\n'
+	return out_str
+
+if __name__ == '__main__':
+
+	filename = 'font.gif'
+	img = Image.open(filename)
+
+	data = b''
+	offsets = []
+	comments = []
+	total_raw = 0
+	for i in range(GLYPHS):
+		height = NUMBER_H if i < 10 else KANJI_H
+		glyph, runs = encode_glyph(img, i, height)
+		raw_size = height * GLYPH_W // 4
+		offsets.append(len(data))
+		comments.append('// Image %d: %d -> %d bytes (saved %d), %.1f runs/row (max %d)' %
+				(i, raw_size, len(glyph), raw_size - len(glyph), sum(runs) / height, max(runs)))
+		sys.stderr.write(comments[-1][3:] + '\n')
+		data += glyph
+		total_raw += raw_size
+	sys.stderr.write('Total: %d -> %d bytes (saved %d)\n' % (total_raw, len(data), total_raw - len(data)))
 
+	print('PROGMEM static const uint16_t imgGlyphOffset[%d] = {' % GLYPHS)
+	for pos in range(0, GLYPHS, 10):
+		print('    ' + ' '.join('%d,' % o for o in offsets[pos:pos + 10]))
+	print('};')
+	print()
+	print('PROGMEM static const uint8_t imgGlyphData[%d] = { // row offsets + run data (see fontconvert.py)' % len(data))
+	for i in range(GLYPHS):
+		end = offsets[i + 1] if i + 1 < GLYPHS else len(data)
+		print('    ' + comments[i])
+		print(format_bytes(data[offsets[i]:end]), end='')
+	print('};')
@@ -4,11 +4,38 @@ import numpy as np
 import os
 import pathlib
 import re
+import struct
 import sys
 import subprocess
+import zlib
 from PIL import Image
 
-def convert2acp(filepath, size_option, ascii_option):
+TILE_H = 64
+HEADER_VERSION = 1
+FLAG_CRC = 1
+FLAG_BANDS = 2
+BAND_H = 16
+
+def crc16(data, crc=0xFFFF):
+	for b in data:
+		crc ^= b
+		for i in range(8):
+			crc = (crc >> 1) ^ 0xA001 if crc & 1 else crc >> 1
+	return crc
+
+def band_table(acep_data, width, height, half):
+	# CRC-16 of the rows in each band as displayed, a half resolution image is doubled
+	rows = np.array(acep_data, dtype=np.uint8).reshape(height, width // 2)
+	if half:
+		pixels = np.stack([rows >> 4, rows & 15], axis=2).reshape(height, width)
+		pixels = pixels.repeat(2, axis=0).repeat(2, axis=1)
+		rows = (pixels[:, 0::2] << 4 | pixels[:, 1::2]).astype(np.uint8)
+	table = b''
+	for top in range(0, rows.shape[0], BAND_H):
+		table += struct.pack('<H', crc16(rows[top:top + BAND_H].tobytes()))
+	return table
+
+def convert2acp(filepath, size_option, ascii_option, header_option, tiled_option, half_option, crc_option, bands_option):
 
 	magick_exe = 'magick'
 	work_filename = 'work.gif'
@@ -31,7 +58,14 @@ def convert2acp(filepath, size_option, ascii_option):
 			if np.array_equal(img_pal[src_index], master_pal[target_index]):
 				index_map[src_index] = target_index
 
-	img_data = np.asarray(img).reshape(-1, 2)
+	img_width, img_height = img.size
+	img_data = np.asarray(img)
+	if tiled_option:
+		# Columns of 2 x 64 pixel tiles, the last tile of each column is padded
+		rows = -img_height % TILE_H
+		img_data = np.pad(img_data, ((0, rows), (0, 0)), constant_values=img_data[0, 0])
+		img_data = img_data.reshape(-1, img_width // 2, 2).transpose(1, 0, 2)
+	img_data = img_data.reshape(-1, 2)
 	acep_data = []
 	for pair in img_data:
 		acep_data.append(index_map[pair[0]] * 16 + index_map[pair[1]])
@@ -55,6 +89,23 @@ def convert2acp(filepath, size_option, ascii_option):
 	else:
 		outputpath = pathlib.PurePath(filepath).stem + '.acp'
 		with open(outputpath_base + '.acp', 'wb') as f:
+			if crc_option or bands_option:
+				# Versioned header: format 0 = raw, 1 = tiled, 2 = half, and CRC-32 of the payload
+				data_format = 2 if half_option else 1 if tiled_option else 0
+				flags = FLAG_CRC
+				table = b''
+				if bands_option and (half_option or not (tiled_option or header_option)):
+					flags |= FLAG_BANDS
+					table = band_table(acep_data, img_width, img_height, half_option)
+				f.write(b'ACeV' + struct.pack('<HHBBBBI', img_width, img_height, HEADER_VERSION, 16 + len(table),
+						data_format, flags, zlib.crc32(bytes(acep_data))))
+				f.write(table)
+			elif half_option:
+				f.write(b'ACeH' + struct.pack('<HH', img_width, img_height))
+			elif tiled_option:
+				f.write(b'ACeT' + struct.pack('<HH', img_width, img_height))
+			elif header_option:
+				f.write(b'ACeP' + struct.pack('<HH', img_width, img_height))
 			f.write(bytes(acep_data))
 
 	return
@@ -62,6 +113,11 @@ def convert2acp(filepath, size_option, ascii_option):
 if __name__ == '__main__':
 
 	ascii_option = False
+	header_option = False
+	tiled_option = False
+	half_option = False
+	crc_option = False
+	bands_option = False
 	size_option = '600x448'
 	target_paths = []
 
@@ -69,6 +125,18 @@ if __name__ == '__main__':
 	for arg in argvs[1:]:
 		if arg == '-ascii':
 			ascii_option = True
+		elif arg == '-header':
+			header_option = True
+		elif arg == '-tiled':
+			tiled_option = True
+			size_option = '448x600'
+		elif arg == '-half':
+			half_option = True
+			size_option = '300x224'
+		elif arg == '-crc':
+			crc_option = True
+		elif arg == '-bands':
+			bands_option = True
 		elif arg == '-keep':
 			size_option = 'keep'
 		elif re.compile('^-\d+x\d+$').search(arg):
@@ -77,10 +145,10 @@ if __name__ == '__main__':
 			target_paths.append(arg)
 
 	if len(target_paths) == 0:
-		print('Usage: %s [-ascii] [-keep] [-WxH] filename ...' % argvs[0])
+		print('Usage: %s [-ascii] [-header] [-tiled] [-half] [-crc] [-bands] [-keep] [-WxH] filename ...' % argvs[0])
 		quit()
 
 	for filepath in target_paths:
-		convert2acp(filepath, size_option, ascii_option)
+		convert2acp(filepath, size_option, ascii_option, header_option, tiled_option, half_option, crc_option, bands_option)
 
 	print('Done!');